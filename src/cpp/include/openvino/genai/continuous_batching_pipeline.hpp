@@ -38,6 +38,16 @@ struct PipelineMetrics {
      */
     size_t scheduled_requests = 0;
 
+    /**
+     * Number of tokens that were scheduled for processing at the previous step of the pipeline.
+     */
+    size_t scheduled_tokens = 0;
+
+    /**
+     * Number of requests that were preempted to free KV cache blocks at the previous step of the pipeline.
+     */
+    size_t preempted_requests = 0;
+
     /**
     * Percentage of KV cache usage in the last generation step.
     */
@@ -208,6 +218,11 @@ public:
     /// Higher level interface, which can process multiple prompts in continuous batching manner
     std::vector<EncodedGenerationResult> generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
     std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
+    /// Streams every request of the batch to its own streamer, streamers[i] receives the outputs of the i-th prompt
+    /// (std::monostate for requests which don't need streaming). All streamers are called from one background thread,
+    /// a streamer is ended as soon as its request finishes.
+    std::vector<EncodedGenerationResult> generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const std::vector<ov::genai::StreamerVariant>& streamers);
+    std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const std::vector<ov::genai::StreamerVariant>& streamers);
     
     std::vector<GenerationResult> generate(
         const std::vector<ChatHistory>& histories,
@@ -620,6 +620,20 @@ operator|(const StructuredOutputConfig::StructuralTag& lhs,
  *        NOTE: ContinuousBatching backend for Speculative Decode uses `num_assistant_tokens` as is. Stateful backend for Speculative Decode uses `num_assistant_tokens`'s
  *        copy as initial value and adjusts it based on recent number of accepted tokens. If `num_assistant_tokens` is not set, it defaults to `5` for both backends.
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
+ * @param num_assistant_branches the number of candidate chains proposed by draft model. Chains start with the draft model's top tokens,
+ *        are validated by main model in a single inference and the longest accepted one is kept.
+ *        NOTE: values > 1 are supported only by ContinuousBatching backend for Speculative Decode with greedy decoding,
+ *        without repetition penalties and structured output.
+ * @param adaptive_num_assistant_tokens if true, the number of candidates is chosen each iteration within [0, num_assistant_tokens] based on
+ *        the request's recent acceptance rate and measured draft / main model latencies; 0 means speculation is a net loss and the request
+ *        is decoded by main model only for a while. NOTE: supported only by ContinuousBatching backend for Speculative Decode with draft model.
+ *
+ * Scheduling parameters (used by ContinuousBatching backend only):
+ * @param priority the priority class of the request. Requests of a higher class are scheduled first and preempted last;
+ *        new requests of lower classes are not admitted while requests of a higher class are missing their latency targets.
+ * @param ttft_target_ms time to first token target in milliseconds, 0 means no target. Within a priority class,
+ *        requests closer to missing their target are scheduled first.
+ * @param tpot_target_ms time per output token target in milliseconds, 0 means no target.
  *
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
  * 
@@ -674,6 +688,13 @@ public:
     float assistant_confidence_threshold = 0.f;
     size_t num_assistant_tokens = 0;
     size_t max_ngram_size = 0;
+    size_t num_assistant_branches = 1;
+    bool adaptive_num_assistant_tokens = false;
+
+    // Scheduling parameters
+    size_t priority = 0;
+    size_t ttft_target_ms = 0;
+    size_t tpot_target_ms = 0;
 
     // Structured output parameters
     std::optional<StructuredOutputConfig> structured_output_config;
@@ -749,6 +770,12 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
 static constexpr ov::Property<float> assistant_confidence_threshold{"assistant_confidence_threshold"};
 static constexpr ov::Property<size_t> num_assistant_tokens{"num_assistant_tokens"};
 static constexpr ov::Property<size_t> max_ngram_size{"max_ngram_size"};
+static constexpr ov::Property<size_t> num_assistant_branches{"num_assistant_branches"};
+static constexpr ov::Property<bool> adaptive_num_assistant_tokens{"adaptive_num_assistant_tokens"};
+
+static constexpr ov::Property<size_t> priority{"priority"};
+static constexpr ov::Property<size_t> ttft_target_ms{"ttft_target_ms"};
+static constexpr ov::Property<size_t> tpot_target_ms{"tpot_target_ms"};
 
 static constexpr ov::Property<StructuredOutputConfig> structured_output_config{"structured_output_config"};
 static constexpr ov::Property<std::string> regex{"regex"};
@@ -396,6 +396,14 @@ static constexpr ov::Property<SchedulerConfig> scheduler_config{"scheduler_confi
 */
 static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 
+/**
+* @brief pipelined_speculative_decoding property serves to run draft and main models of speculative decoding concurrently.
+* Set `true` to activate this mode: requests are split into two groups, draft model generates candidates for one group
+* while main model validates candidates of the other one.
+* And create LLMPipeline instance with this config together with draft_model property.
+*/
+static constexpr ov::Property<bool> pipelined_speculative_decoding{"pipelined_speculative_decoding"};
+
 /**
 * @brief enable enable_save_ov_model property serves to serialize ov model (xml/bin) generated from gguf model on disk for re-use.
 * Set `true` to activate this mode.
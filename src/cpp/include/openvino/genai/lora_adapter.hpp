@@ -191,11 +191,17 @@ public:
 
     AdapterController() = default;
 
-    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device);
+    // If `per_request_adapters` is true, adapters from `config` can be selected individually for each token with
+    // `lora_slot_ids` and `lora_slot_alphas` model inputs, which allows mixing requests with different adapters in one batch.
+    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_request_adapters = false);
 
     // Apply adapters configured in the current config set last time, or set and use new config given as optional `config` argument
     void apply(ov::InferRequest request, const std::optional<AdapterConfig>& config = std::nullopt);
 
+    // Returns alphas of all adapters registered in the constructor for a given request `config`,
+    // 0 for adapters which are not used. Available only when `per_request_adapters` is enabled.
+    std::vector<float> get_per_request_alphas(const std::optional<AdapterConfig>& config) const;
+
     // Returns true if a given name is one of the state names created by this adapter controller for dynamic LoRA
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
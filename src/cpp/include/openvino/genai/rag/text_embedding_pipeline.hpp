@@ -50,6 +50,25 @@ public:
         LAST_TOKEN = 2,
     };
 
+    enum class EmbeddingType {
+        /**
+         * @brief f32 embeddings, returned as std::vector<float>
+         */
+        FLOAT = 0,
+
+        /**
+         * @brief Embeddings scaled by 127 / max(abs(embedding)) and rounded, returned as std::vector<int8_t>.
+         * The scale differs between embeddings, so they should be compared with cosine similarity.
+         */
+        INT8 = 1,
+
+        /**
+         * @brief Signs of embedding values packed into bits, 1 for positive values, the most significant bit first.
+         * Returned as std::vector<uint8_t> of ceil(embedding size / 8) bytes to be compared with Hamming distance.
+         */
+        UBINARY = 2,
+    };
+
     struct OPENVINO_GENAI_EXPORTS Config {
         /**
          * @brief Maximum length of tokens passed to the embedding model
@@ -69,11 +88,19 @@ public:
         /**
          * @brief Batch size of embedding model.
          * Useful for database population. If set, the pipeline will fix model shape for inference optimization. 
-         * Number of documents passed to pipeline should be equal to batch_size.
+         * Documents are embedded in batches of batch_size, the last batch is filled up with repeated documents.
          * For query embeddings, batch_size should be set to 1 or not set.
          */
         std::optional<size_t> batch_size;
 
+        /**
+         * @brief Maximum number of tokens, including padding, in a batch of embedding model if batch_size is not set.
+         * Documents are sorted by length and split into batches within the budget, so short documents aren't padded
+         * to the longest one. Batches run on several infer requests in parallel with
+         * ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT). 0 embeds all documents in one batch.
+         */
+        size_t max_batch_tokens = 16384;
+
         /**
          * @brief Pooling strategy applied to model output tensor
          */
@@ -84,6 +111,17 @@ public:
          */
         bool normalize = true;
 
+        /**
+         * @brief Number of the first embedding values to keep for models trained with Matryoshka representation
+         * learning. Truncation is applied before L2 normalization. If not set, the whole embedding is kept.
+         */
+        std::optional<size_t> embedding_dimensions;
+
+        /**
+         * @brief Type of embeddings. Quantization is done by the model, so only quantized embeddings are copied.
+         */
+        EmbeddingType embedding_type = EmbeddingType::FLOAT;
+
         /**
          * @brief Instruction to use for embedding a query
          */
@@ -203,6 +241,16 @@ static constexpr ov::Property<bool> normalize{"normalize"};
  */
 static constexpr ov::Property<TextEmbeddingPipeline::PoolingType> pooling_type{"pooling_type"};
 
+/**
+ * @brief Number of the first embedding values to keep for Matryoshka models
+ */
+static constexpr ov::Property<size_t> embedding_dimensions{"embedding_dimensions"};
+
+/**
+ * @brief Type of embeddings: f32, int8 scalar quantized or sign bits
+ */
+static constexpr ov::Property<TextEmbeddingPipeline::EmbeddingType> embedding_type{"embedding_type"};
+
 /**
  * @brief Instruction to use for embedding query
  */
@@ -216,9 +264,15 @@ static constexpr ov::Property<std::string> embed_instruction{"embed_instruction"
 /**
  * @brief Batch size for embedding model.
  * If batch_size, max_length and pad_to_max_length are set, the pipeline will fix model shape
- * for inference optimization. Number of documents passed to pipeline should be equal to batch_size.
+ * for inference optimization. Documents are embedded in batches of batch_size.
  */
 static constexpr ov::Property<size_t> batch_size{"batch_size"};
 
+/**
+ * @brief Maximum number of tokens, including padding, in a batch of embedding or rerank model.
+ * Documents are sorted by length and split into batches within the budget. 0 processes all documents in one batch.
+ */
+static constexpr ov::Property<size_t> max_batch_tokens{"max_batch_tokens"};
+
 }  // namespace genai
 }  // namespace ov
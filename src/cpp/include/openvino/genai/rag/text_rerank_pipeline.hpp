@@ -31,6 +31,15 @@ public:
          */
         std::optional<std::string> padding_side;
 
+        /**
+         * @brief Maximum number of tokens, including padding, in a batch of rerank model.
+         * Documents are sorted by length and split into batches within the budget, so short documents aren't padded
+         * to the longest one. For stateful decoder models, like Qwen3 reranker, tokens shared by all query-document
+         * pairs are inferred once and the budget counts only tokens after them. 0 reranks all documents in one batch.
+         * Can be set with ov::genai::max_batch_tokens.
+         */
+        size_t max_batch_tokens = 16384;
+
         /**
          * @brief Constructs text rerank pipeline configuration
          */
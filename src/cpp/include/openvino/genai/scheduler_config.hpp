@@ -5,11 +5,22 @@
 
 #include <cstddef>
 #include <sstream>
+#include <string>
 
 #include "openvino/genai/cache_eviction.hpp"
 #include "openvino/genai/sparse_attention.hpp"
 
 namespace ov::genai {
+
+/**
+ * @brief Represents the way the scheduler frees KV-cache blocks of a running sequence group when there are not enough
+ * free blocks to continue generation.
+ */
+enum class PreemptionMode {
+    RECOMPUTE,  // the blocks are released and the prompt together with the generated tokens is processed again later
+    SWAP        // the contents of the blocks are copied to a host memory pool and copied back later
+};
+
 struct SchedulerConfig {
     // a maximum number of tokens to batch
     // (in contrast to max_batch_size which combines independent sequences, we consider total amount of tokens in a batch)
@@ -61,6 +72,29 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
+    // Path to a file used as a persistent, second-tier prefix cache. Requires enable_prefix_caching and a fixed KV-cache size
+    // (num_kv_blocks or cache_size), supported for KV-cache allocated in host memory (CPU).
+    // When set, KV-blocks which are about to be overwritten in the in-memory prefix cache are written to this file
+    // and restored from it when a new prompt shares the prefix, also after the pipeline is re-created in another process.
+    // The file is tied to the KV-cache layout of the model; a file produced for a different layout is discarded.
+    // Different models with identical KV-cache layout must not share the same file.
+    // When empty, spilling is turned off.
+    std::string prefix_cache_spill_path;
+
+    // maximum size of the prefix cache spill file in GB
+    std::size_t prefix_cache_spill_size = 1;
+
+    // How to preempt running sequence groups when KV-cache is exhausted.
+    // PreemptionMode::SWAP is supported for KV-cache allocated in host memory (CPU), otherwise sequence groups are recomputed.
+    PreemptionMode preemption_mode = PreemptionMode::RECOMPUTE;
+
+    // size of the host memory pool for swapped out KV-blocks in GB; used with PreemptionMode::SWAP
+    std::size_t swap_space_size = 4;
+
+    // minimal number of processed tokens of a sequence group to swap it out with PreemptionMode::SWAP;
+    // shorter sequence groups are cheap to recompute and are preempted by recomputation
+    std::size_t swap_min_num_tokens = 512;
+
     /** Whether to apply block-wise sparse attention to the prefill stage.
      */
     bool use_sparse_attention = false;
@@ -72,7 +106,10 @@ struct SchedulerConfig {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               prefix_cache_spill_path == other.prefix_cache_spill_path && prefix_cache_spill_size == other.prefix_cache_spill_size &&
+               preemption_mode == other.preemption_mode && swap_space_size == other.swap_space_size &&
+               swap_min_num_tokens == other.swap_min_num_tokens;
     }
 
     /**
@@ -95,6 +132,15 @@ struct SchedulerConfig {
         }
         oss << "  max_num_seqs: " << max_num_seqs << "\n";
         oss << "  enable_prefix_caching: " << std::boolalpha << enable_prefix_caching << "\n";
+        if (!prefix_cache_spill_path.empty()) {
+            oss << "  prefix_cache_spill_path: " << prefix_cache_spill_path << "\n";
+            oss << "  prefix_cache_spill_size: " << prefix_cache_spill_size << "\n";
+        }
+        oss << "  preemption_mode: " << (preemption_mode == PreemptionMode::SWAP ? "SWAP" : "RECOMPUTE") << "\n";
+        if (preemption_mode == PreemptionMode::SWAP) {
+            oss << "  swap_space_size: " << swap_space_size << "\n";
+            oss << "  swap_min_num_tokens: " << swap_min_num_tokens << "\n";
+        }
         oss << "  use_sparse_attention: " << std::boolalpha << use_sparse_attention << "\n";
         if (use_sparse_attention) {
             oss << sparse_attention_config.to_string() << "\n";
@@ -12,6 +12,8 @@ namespace genai {
 
 using CallbackTypeVariant = std::variant<bool, StreamingStatus>;
 
+class IncrementalDetokenizer;
+
 /**
  * @brief TextStreamer is used to decode tokens into text and call a user-defined callback function.
  *
@@ -35,6 +37,10 @@ protected:
     std::vector<int64_t> m_decoded_lengths;
     size_t m_printed_len = 0;
     ov::AnyMap m_additional_detokenization_params;
+    // decodes tokens natively instead of running the detokenizer model for the whole cache, nullptr if not supported
+    std::shared_ptr<IncrementalDetokenizer> m_incremental_detokenizer;
+    // text of m_tokens_cache decoded by m_incremental_detokenizer
+    std::string m_text;
 
     StreamingStatus set_streaming_status(CallbackTypeVariant callback_status);
 
@@ -29,6 +29,22 @@ struct TokenizedInputs {
     std::optional<ov::Tensor> token_type_ids;
 };
 
+/**
+ * @brief Counters of the tokenization cache enabled by ov::genai::tokenization_cache_size.
+ */
+struct TokenizationCacheStats {
+    // text segments taken from the cache
+    size_t hits = 0;
+    // text segments run through the tokenizer model
+    size_t misses = 0;
+    // token ids kept in the cache
+    size_t num_cached_tokens = 0;
+
+    float get_hit_rate() const {
+        return hits + misses == 0 ? 0.0f : static_cast<float>(hits) / static_cast<float>(hits + misses);
+    }
+};
+
 /**
  * @brief The class is used to encode prompts and decode resulting tokens
  *
@@ -317,6 +333,9 @@ public:
      /// @brief Check if the tokenizer supports paired input.
     bool supports_paired_input() const;
 
+    /// @brief Get counters of the tokenization cache, all zeros if ov::genai::tokenization_cache_size is not set or the cache is disabled.
+    TokenizationCacheStats get_tokenization_cache_stats() const;
+
     Tokenizer() = default;
     ~Tokenizer();
     bool operator==(const Tokenizer& other) const {
@@ -326,6 +345,7 @@ public:
 private:
     friend class StructuredOutputConfig;
     friend class Sampler;
+    friend class TextStreamer;
     std::shared_ptr<TokenizerImpl> m_pimpl;
 };
 
@@ -334,6 +354,16 @@ static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
 static constexpr ov::Property<bool> skip_special_tokens{"skip_special_tokens"};
 static constexpr ov::Property<bool> pad_to_max_length{"pad_to_max_length"};
 static constexpr ov::Property<std::string> padding_side{"padding_side"};
+/**
+ * @brief Budget in token ids of the LRU cache of tokenized text segments, 0 (default) disables the cache.
+ * Set it in Tokenizer constructor properties for chat and RAG workloads which encode the same system prompt, previous
+ * turns or documents repeatedly: the text is split by special tokens and only uncached segments are tokenized.
+ * Encoding with max_length or padding parameters bypasses the cache.
+ * The cache is used only if tokenizer.json in the models directory shows that splitting the text by special tokens
+ * keeps its tokenization: special tokens don't strip or normalize the text around them, and the normalizer and
+ * pre-tokenizer don't add a prefix to the text like the SentencePiece dummy prefix. Otherwise it stays disabled.
+ */
+static constexpr ov::Property<size_t> tokenization_cache_size{"tokenization_cache_size"};
 
 }  // namespace genai
 }  // namespace ov
@@ -6,11 +6,12 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <fstream>
-#include <chrono>
 
 #include "sequence_group.hpp"
+#include "continuous_batching/kv_cache_spill_store.hpp"
 
 namespace ov::genai {
 
@@ -18,7 +19,6 @@ class KVCacheBlock {
     int m_ref_count;
     int m_index;
     size_t m_hash;
-    std::chrono::time_point<std::chrono::steady_clock> m_timestamp;
 public:
     using Ptr = std::shared_ptr<KVCacheBlock>;
     using CPtr = std::shared_ptr<const KVCacheBlock>;
@@ -26,8 +26,7 @@ public:
     explicit KVCacheBlock(int index)
         : m_ref_count(0),
           m_index(index),
-          m_hash(0),
-          m_timestamp(std::chrono::steady_clock::now()) { }
+          m_hash(0) { }
 
     int get_index() const {
         return m_index;
@@ -61,14 +60,6 @@ public:
     void set_hash(size_t hash) {
         m_hash = hash;
     }
-
-    void set_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& timestamp) {
-        m_timestamp = timestamp;
-    }
-
-    std::chrono::time_point<std::chrono::steady_clock> get_timestamp() {
-        return m_timestamp;
-    }
 };
 
 using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
@@ -78,10 +69,23 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * Blocks with the same prefix in the generated sequence will have the same hash. Blocks within this store
  * are not owned by any sequence (but had been once) and may be either selected for overwriting, if the allocator
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
+ * Blocks are kept in a list ordered by the time they were returned to the store, with a hash index into the list,
+ * so that adding, restoring and overwriting a block are O(1) regardless of the number of stored blocks.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    using LRUList = std::list<std::pair<size_t, BlocksPerLayer>>;
+    // least recently used blocks are at the front
+    LRUList m_lru_list;
+    std::unordered_map<size_t, LRUList::iterator> m_blocks;
     size_t m_num_layers;
+
+    BlocksPerLayer _pop(LRUList::iterator it) {
+        BlocksPerLayer blocks_for_all_layers = std::move(it->second);
+        m_blocks.erase(it->first);
+        m_lru_list.erase(it);
+        return blocks_for_all_layers;
+    }
+
     public:
     /**
      * Constructs the BlockHashStore.
@@ -91,6 +95,7 @@ class OverwritableBlocksHashStore {
 
     /**
      * Registers allocated KV cache blocks as overwritable. The blocks must not be owned by any sequence.
+     * The blocks become the most recently used ones in the store.
      * @param blocks_for_all_layers A vector of KV cache blocks (one for each decoder layer) to be added to the store.
      * The hash of each block across the vector must be identical.
      */
@@ -105,7 +110,8 @@ class OverwritableBlocksHashStore {
             }
         }
         OPENVINO_ASSERT(m_blocks.count(hash) == 0);
-        m_blocks[hash] = blocks_for_all_layers;
+        m_lru_list.emplace_back(hash, blocks_for_all_layers);
+        m_blocks.emplace(hash, std::prev(m_lru_list.end()));
     }
 
 
@@ -121,34 +127,26 @@ class OverwritableBlocksHashStore {
         {
             return {};
         }
-        BlocksPerLayer blocks_for_all_layers = it->second;
+        BlocksPerLayer blocks_for_all_layers = _pop(it->second);
         for (auto& block_ptr : blocks_for_all_layers) {
-
-            block_ptr->set_timestamp(std::chrono::steady_clock::now());
             block_ptr->increment();
         }
-        m_blocks.erase(it);
         return blocks_for_all_layers;
     }
 
     /**
      * Pops the least recently used blocks from the store to be used and overwritten by another sequence.
      * Returned blocks will have reference counters equal to 1.
-     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store
-     * based on the timestamp.
+     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store.
      */
     BlocksPerLayer get_lru_block_to_overwrite() {
-        if (m_blocks.empty()) {
+        if (m_lru_list.empty()) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
-        auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
-        auto timestamp = std::chrono::steady_clock::now();
+        BlocksPerLayer blocks_for_all_layers = _pop(m_lru_list.begin());
         for (auto& block_ptr : blocks_for_all_layers) {
-            block_ptr->set_timestamp(timestamp);
             block_ptr->increment();
         }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
         return blocks_for_all_layers;
     }
 
@@ -160,6 +158,19 @@ class OverwritableBlocksHashStore {
         return m_blocks.size();
     }
 
+    /**
+     * @return All blocks currently in the store (one vector of per-layer blocks for each stored hash),
+     * from the least to the most recently used. The blocks remain in the store.
+     */
+    std::vector<BlocksPerLayer> get_all_blocks() const {
+        std::vector<BlocksPerLayer> retval;
+        retval.reserve(m_lru_list.size());
+        for (const auto& hash_and_blocks : m_lru_list) {
+            retval.push_back(hash_and_blocks.second);
+        }
+        return retval;
+    }
+
     /**
      * @brief Removes blocks matching to the supplied hashes from the store
      * @param hashes_to_discard A set of hashes. For each hash, if it is present in the store, the corresponding block will be discarded
@@ -172,8 +183,7 @@ class OverwritableBlocksHashStore {
         for (uint64_t hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
-                retval.push_back(it->second);
-                m_blocks.erase(it);
+                retval.push_back(_pop(it->second));
             }
         }
         return retval;
@@ -181,25 +191,117 @@ class OverwritableBlocksHashStore {
 
     void clear() {
         m_blocks.clear();
+        m_lru_list.clear();
     }
 };
 
 class CacheStateDumper;
 
+/**
+ * @brief FIFO queue of KV cache block indices stored in a contiguous ring buffer.
+ * Capacity is set explicitly and is expected to be the total number of blocks, so that pushing and popping
+ * never allocates.
+ */
+class BlockIndexQueue {
+    std::vector<int32_t> m_ring;
+    size_t m_head = 0;
+    size_t m_size = 0;
+public:
+    size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    int32_t front() const {
+        OPENVINO_ASSERT(m_size > 0, "BlockIndexQueue is empty");
+        return m_ring[m_head];
+    }
+
+    void pop_front() {
+        OPENVINO_ASSERT(m_size > 0, "BlockIndexQueue is empty");
+        m_head = (m_head + 1) % m_ring.size();
+        --m_size;
+    }
+
+    void push_back(int32_t block_idx) {
+        OPENVINO_ASSERT(m_size < m_ring.size(), "BlockIndexQueue capacity ", m_ring.size(), " exceeded");
+        m_ring[(m_head + m_size) % m_ring.size()] = block_idx;
+        ++m_size;
+    }
+
+    /**
+     * Grows the capacity of the queue preserving the order of the queued indices.
+     * @param capacity New capacity, ignored if not greater than the current one.
+     */
+    void reserve(size_t capacity) {
+        if (capacity <= m_ring.size()) {
+            return;
+        }
+        std::vector<int32_t> ring(capacity);
+        for (size_t i = 0; i < m_size; ++i) {
+            ring[i] = m_ring[(m_head + i) % m_ring.size()];
+        }
+        m_ring = std::move(ring);
+        m_head = 0;
+    }
+
+    void clear() {
+        m_ring.clear();
+        m_head = 0;
+        m_size = 0;
+    }
+};
+
 /**
  * @brief Maintains a pool of KV cache block descriptors (layered as configured at initialization), freeing or allocating
  * them as requested.
  */
 class BlockAllocator {
-    std::vector<std::list<KVCacheBlock::Ptr>> m_free_blocks;
-    // We keep m_free_blocks_num instead of m_free_blocks[X].size() to WA old CXX library implementation issue for std::list::size()
-    // see https://stackoverflow.com/questions/13157164/why-isnt-stdlist-size-constant-time
-    std::vector<size_t> m_free_blocks_num;
+    // all block descriptors owned by the allocator, per layer, indexed by the physical block index
+    std::vector<std::vector<KVCacheBlock::Ptr>> m_block_pool;
+    // indices of free blocks, per layer; freed blocks are reused in FIFO order
+    std::vector<BlockIndexQueue> m_free_blocks;
     size_t m_total_num_blocks;
     friend class CacheStateDumper;
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
+    std::shared_ptr<KVCacheSpillStore> m_spill_store;
+
+    static std::vector<size_t> _get_block_indices(const BlocksPerLayer& blocks_for_all_layers) {
+        std::vector<size_t> block_indices;
+        block_indices.reserve(blocks_for_all_layers.size());
+        for (const auto& block : blocks_for_all_layers) {
+            block_indices.push_back(block->get_index());
+        }
+        return block_indices;
+    }
+
+    void _add_blocks(size_t new_kv_blocks_count) {
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+            auto& layer_pool = m_block_pool[layer_idx];
+            auto& layer_free_blocks = m_free_blocks[layer_idx];
+            layer_free_blocks.reserve(new_kv_blocks_count);
+            layer_pool.reserve(new_kv_blocks_count);
+            for (size_t block_id = layer_pool.size(); block_id < new_kv_blocks_count; ++block_id) {
+                layer_pool.push_back(std::make_shared<KVCacheBlock>(block_id));
+                layer_free_blocks.push_back(static_cast<int32_t>(block_id));
+            }
+        }
+    }
+
+    void _push_free_block(const KVCacheBlock::Ptr& block_ptr, size_t layer_idx) {
+        m_free_blocks[layer_idx].push_back(block_ptr->get_index());
+    }
+
+    const KVCacheBlock::Ptr& _pop_free_block(size_t layer_idx) {
+        int32_t block_idx = m_free_blocks[layer_idx].front();
+        m_free_blocks[layer_idx].pop_front();
+        return m_block_pool[layer_idx][block_idx];
+    }
 
 public:
     /**
@@ -213,49 +315,56 @@ public:
     BlockAllocator(size_t num_blocks, bool enable_prefix_caching, size_t num_layers = 1) :
             m_total_num_blocks(num_blocks), m_num_layers(num_layers), m_enable_prefix_caching(enable_prefix_caching), m_overwriteable_blocks(num_layers) {
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        m_block_pool.resize(m_num_layers);
         m_free_blocks.resize(m_num_layers);
-        if (num_blocks > 0) {
-            m_free_blocks_num = std::vector<size_t>(num_layers, num_blocks);
-            for (auto& per_layer_block_list : m_free_blocks) {
-                for (int block_id = 0; block_id < m_total_num_blocks; ++block_id) {
-                    per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-                }
-            }
-        } else {
-            m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
-        }
+        _add_blocks(num_blocks);
     }
 
     ~BlockAllocator() {
         // sanity check to validate that all blocks are freed
-        for (auto& free_block : m_free_blocks_num) {
-            size_t free_and_overwritable_block_cnt = free_block + num_overwriteable_blocks();
+        for (const auto& free_blocks : m_free_blocks) {
+            size_t free_and_overwritable_block_cnt = free_blocks.size() + num_overwriteable_blocks();
             OPENVINO_ASSERT(m_total_num_blocks == free_and_overwritable_block_cnt, "Expected num free blocks: ", m_total_num_blocks, ", actual: ", free_and_overwritable_block_cnt);
         }
     }
 
     void increase_kv_blocks_number(size_t new_kv_blocks_count) {
         OPENVINO_ASSERT(new_kv_blocks_count > m_total_num_blocks, "New blocks number should be more than previous blocks number.");
-        size_t added_blocks = new_kv_blocks_count - m_total_num_blocks;
-        for (auto idx = 0; idx < m_free_blocks_num.size(); idx++) {
-            m_free_blocks_num[idx] += added_blocks;
-        }
-        for (auto& per_layer_block_list : m_free_blocks) {
-            for (int block_id = m_total_num_blocks; block_id < new_kv_blocks_count; ++block_id) {
-                per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-            }
-        }
+        _add_blocks(new_kv_blocks_count);
         m_total_num_blocks = new_kv_blocks_count;
     }
 
 
+    /**
+     * Sets the second-tier store to which contents of overwritable blocks are spilled before they are reused.
+     * Can only be used if prefix caching is enabled.
+     * @param spill_store The spill store, or nullptr to disable spilling.
+     */
+    void set_spill_store(std::shared_ptr<KVCacheSpillStore> spill_store) {
+        OPENVINO_ASSERT(m_enable_prefix_caching || !spill_store, "KV cache spilling requires prefix caching to be enabled");
+        m_spill_store = std::move(spill_store);
+    }
+
+    /**
+     * Schedules spilling of all blocks currently kept in the overwritable block store, so that their contents
+     * outlive the allocator.
+     */
+    void spill_overwriteable_blocks() {
+        if (!m_spill_store) {
+            return;
+        }
+        for (const auto& blocks_for_all_layers : m_overwriteable_blocks.get_all_blocks()) {
+            m_spill_store->schedule_spill(blocks_for_all_layers[0]->get_hash(), _get_block_indices(blocks_for_all_layers));
+        }
+    }
+
     /**
      * Returns the number of free blocks for a given layer.
      * @param layer_idx Index of the layer.
      * @return Number of free blocks for this layer.
      */
     size_t num_free_blocks(size_t layer_idx) const {
-        return m_free_blocks_num[layer_idx] + num_overwriteable_blocks();
+        return m_free_blocks[layer_idx].size() + num_overwriteable_blocks();
     }
 
     /**
@@ -300,8 +409,7 @@ public:
         OPENVINO_ASSERT(layer_idx < m_num_layers);
         block_ptr->release();
         if (block_ptr->is_free()) {
-            m_free_blocks[layer_idx].push_back(block_ptr);
-            ++m_free_blocks_num[layer_idx];
+            _push_free_block(block_ptr, layer_idx);
         }
     }
 
@@ -356,8 +464,7 @@ public:
 
                         // actual collision case
                         for (size_t layer_idx = 0; layer_idx < colliding_blocks_per_layer.size(); layer_idx++) {
-                            m_free_blocks[layer_idx].push_back(colliding_blocks_per_layer[layer_idx]);
-                            ++m_free_blocks_num[layer_idx];
+                            _push_free_block(colliding_blocks_per_layer[layer_idx], layer_idx);
                         }
 
                         // As block returns to free memory, it should be removed from cached_blocks.
@@ -379,15 +486,13 @@ public:
                     // This set of blocks to be freed corresponds to blocks from different time steps, and thus not eligible for caching
                     // TODO (vshampor): more fine-grained hash store control
                     for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                        m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                        ++m_free_blocks_num[layer_idx];
+                        _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                     }
                 }
             }
             else {
                 for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                    m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                    ++m_free_blocks_num[layer_idx];
+                    _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                 }
             }
         }
@@ -414,10 +519,8 @@ public:
         OPENVINO_ASSERT(layer_idx < m_free_blocks.size());
         OPENVINO_ASSERT(!m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1, layer_idx));
-        KVCacheBlock::Ptr allocated_block = m_free_blocks[layer_idx].front();
+        const KVCacheBlock::Ptr& allocated_block = _pop_free_block(layer_idx);
         allocated_block->increment();
-        m_free_blocks[layer_idx].pop_front();
-        --m_free_blocks_num[layer_idx];
         return allocated_block;
     }
 
@@ -436,17 +539,15 @@ public:
         OPENVINO_ASSERT(m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1));
 
-        if (m_free_blocks_num[0] > 0) {
+        if (!m_free_blocks[0].empty()) {
             // allocate new empty block
             BlocksPerLayer allocated_blocks;
             allocated_blocks.reserve(m_num_layers);
             for (size_t i = 0; i < m_num_layers; i++) {
-                KVCacheBlock::Ptr allocated_block = m_free_blocks[i].front();
+                const KVCacheBlock::Ptr& allocated_block = _pop_free_block(i);
                 allocated_block->increment();
                 allocated_block->set_hash(hash);
                 allocated_blocks.push_back(allocated_block);
-                m_free_blocks[i].pop_front();
-                --m_free_blocks_num[i];
             }
             cached_blocks[hash] = allocated_blocks;
             return allocated_blocks;
@@ -455,6 +556,10 @@ public:
             // get least recently used block from store and reuse it
             BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
             cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
+            if (m_spill_store) {
+                // contents are still intact until the next inference, keep them in the second-tier store
+                m_spill_store->schedule_spill(blocks_for_all_layers[0]->get_hash(), _get_block_indices(blocks_for_all_layers));
+            }
 
             // update block with new hash
             for (auto& block : blocks_for_all_layers) {
@@ -512,9 +617,9 @@ public:
 
     void clear() {
         m_total_num_blocks = 0;
-        m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
-        for (auto& per_layer_block_list : m_free_blocks) {
-            per_layer_block_list.clear();
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+            m_block_pool[layer_idx].clear();
+            m_free_blocks[layer_idx].clear();
         }
         m_overwriteable_blocks.clear();
     }
@@ -540,6 +645,78 @@ class BlockManager {
     std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
 
     std::mutex m_cached_blocks_map_mutex;
+    std::shared_ptr<KVCacheSpillStore> m_spill_store;
+
+    /**
+     * Allocates fresh blocks for a hash missing in the in-memory prefix cache and schedules restoring their contents
+     * from the spill store. The block is read from disk with `lock` (on m_cached_blocks_map_mutex) released.
+     * @return The allocated blocks, the cached ones if the hash was restored by another request while reading,
+     * or an empty vector if the hash is not in the spill store or no block can be allocated.
+     */
+    /**
+     * @return Whether the cached tokens of the group end in the middle of a block, so that the next tokens are written
+     * into the current last block of each sequence.
+     */
+    bool _is_last_block_partially_filled(const SequenceGroup::CPtr& seq_group) const {
+        return (seq_group->get_num_processed_tokens() - seq_group->get_num_evicted_tokens()) % m_block_size != 0;
+    }
+
+    /**
+     * Replaces the last block of the sequence, which is shared with other sequences, with a fresh copy.
+     * The block contents have to be copied by CacheManager as reported in `copy_blocks_map`.
+     */
+    void _copy_last_block_on_write(const Sequence::Ptr& sequence, std::map<size_t, std::list<size_t>>& copy_blocks_map) {
+        auto seq_id = sequence->get_id();
+        size_t effective_num_layers = m_block_table[seq_id].size();
+        BlocksPerLayer last_blocks;
+        last_blocks.reserve(effective_num_layers);
+        for (size_t i = 0; i < effective_num_layers; i++) {
+            last_blocks.push_back(m_block_table[seq_id][i].back());
+        }
+
+        BlocksPerLayer new_blocks_for_all_layers;
+        new_blocks_for_all_layers.reserve(effective_num_layers);
+        if (m_enable_prefix_caching) {
+            auto hash = sequence->get_hash();
+            new_blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
+        } else {
+            for (size_t i = 0; i < effective_num_layers; i++) {
+                new_blocks_for_all_layers.push_back(m_allocator.allocate_block(i));
+            }
+        }
+
+        for (size_t i = 0; i < effective_num_layers; i++) {
+            m_block_table[seq_id][i].back() = new_blocks_for_all_layers[i];
+            copy_blocks_map[last_blocks[i]->get_index()].push_back(new_blocks_for_all_layers[i]->get_index());
+        }
+        m_allocator.free(last_blocks, m_prefix_hash_to_occupied_block_map);
+    }
+
+    BlocksPerLayer _restore_spilled_block(size_t hash, std::unique_lock<std::mutex>& lock) {
+        if (!m_spill_store || !m_spill_store->contains(hash) || !m_allocator.can_allocate_blocks(1)) {
+            return {};
+        }
+        std::vector<uint8_t> data = m_spill_store->acquire_buffer();
+        // other requests should not wait for the disk read
+        lock.unlock();
+        const bool is_read = m_spill_store->read(hash, data.data());
+        lock.lock();
+
+        auto blocks = is_read ? m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map) : BlocksPerLayer{};
+        if (!is_read || !blocks.empty() || !m_allocator.can_allocate_blocks(1)) {
+            m_spill_store->release_buffer(std::move(data));
+            return blocks;
+        }
+        blocks = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
+        std::vector<size_t> block_indices;
+        block_indices.reserve(blocks.size());
+        for (const auto& block : blocks) {
+            block_indices.push_back(block->get_index());
+        }
+        m_spill_store->schedule_restore(hash, std::move(block_indices), std::move(data));
+        return blocks;
+    }
+
 public:
     /**
      * Constructs the BlockManager.
@@ -561,6 +738,25 @@ public:
         OPENVINO_ASSERT(m_block_table.empty());
     }
 
+    /**
+     * Enables the second-tier prefix cache: blocks overwritten in the in-memory prefix cache are spilled into the store,
+     * and prompt blocks missing in memory are looked up in the store by `restore_cached_blocks`.
+     * The scheduled transfers must be executed by the owner of the KV cache tensors (see KVCacheSpillStore::take_pending_transfers).
+     * @param spill_store The spill store, or nullptr to disable spilling.
+     */
+    void set_spill_store(std::shared_ptr<KVCacheSpillStore> spill_store) {
+        m_allocator.set_spill_store(spill_store);
+        m_spill_store = std::move(spill_store);
+    }
+
+    /**
+     * Schedules spilling of all cached blocks which are not owned by any sequence, e.g. before the pipeline is destroyed.
+     */
+    void spill_cached_blocks() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        m_allocator.spill_overwriteable_blocks();
+    }
+
     /**
      * Gets the block table for a given sequence.
      * @param seq_id The identifier of an ov::genai::Sequence.
@@ -952,6 +1148,17 @@ public:
      * allocated ones.
      */
     size_t required_blocks_count(SequenceGroup::CPtr seq_group) {
+        const size_t num_logical_blocks = seq_group->get_num_logical_blocks();
+        return required_blocks_count(std::move(seq_group), num_logical_blocks);
+    }
+
+    /**
+     * @param seq_group Pointer to a sequence group.
+     * @param num_logical_blocks The number of blocks each running sequence of the group has to hold.
+     * @return The number of blocks necessary to host `num_logical_blocks` blocks of each sequence in the group,
+     * excluding the already allocated ones.
+     */
+    size_t required_blocks_count(SequenceGroup::CPtr seq_group, size_t num_logical_blocks) {
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
         std::vector<Sequence::CPtr> running_sequences = seq_group->get_running_sequences();
         size_t blocks_count = 0; // total number of needed blocks for sequence group
@@ -961,16 +1168,16 @@ public:
             auto seq_id = seq->get_id();
             if (m_block_table.find(seq_id) == m_block_table.end()) {
                 // the block table is empty, so we need to allocate the number of blocks equal to number of logical blocks
-                blocks_count += seq_group->get_num_logical_blocks();
+                blocks_count += num_logical_blocks;
                 continue;
             }
             auto& block_table = m_block_table[seq_id][0];
             size_t num_physical_blocks = block_table.size();
             OPENVINO_ASSERT(num_physical_blocks > 0);
 
-            if (num_physical_blocks > seq_group->get_num_logical_blocks())
+            if (num_physical_blocks > num_logical_blocks)
                 // new blocks are not required
-                // Case when num_physical_blocks == seq_group->get_num_logical_blocks() may still need block allocation
+                // Case when num_physical_blocks == num_logical_blocks may still need block allocation
                 // (such as when a sequence with an incomplete last block was forked) and is handled further in the
                 // iteration
                 continue;
@@ -982,7 +1189,7 @@ public:
                 continue;
             last_block_ids.insert(last_block_id);
 
-            size_t needed_blocks_per_sequence = seq_group->get_num_logical_blocks() - num_physical_blocks;
+            size_t needed_blocks_per_sequence = num_logical_blocks - num_physical_blocks;
 
             KVCacheBlock::Ptr last_block = block_table.back();
             if (last_block->copy_on_write()) {
@@ -995,6 +1202,10 @@ public:
                 }
                 else {
                     blocks_count += needed_blocks_per_sequence * references_count;
+                    if (_is_last_block_partially_filled(seq_group)) {
+                        // the next tokens start in the last block, so it is also copied before new blocks are appended
+                        blocks_count += references_count - 1;
+                    }
                 }
             }
             else {
@@ -1053,6 +1264,12 @@ public:
             }
 
             if (num_logical_blocks > num_physical_blocks) {
+                if (num_physical_blocks > 0 && m_block_table[seq_id][0].back()->copy_on_write() &&
+                    _is_last_block_partially_filled(seq_group)) {
+                    // several tokens scheduled at once (e.g. forked speculative decoding branches) start in the shared
+                    // last block before crossing into the new ones, so it must not be written in place
+                    _copy_last_block_on_write(sequence, copy_blocks_map);
+                }
                 OPENVINO_ASSERT(can_allocate_blocks(num_logical_blocks - num_physical_blocks));
                 allocate(sequence, num_logical_blocks - num_physical_blocks, seq_group->get_prompt_len());
             } else {
@@ -1068,25 +1285,7 @@ public:
                 bool is_copy_on_write = last_blocks[0]->copy_on_write();
 
                 if (is_copy_on_write) {
-                    BlocksPerLayer new_blocks_for_all_layers;
-                    new_blocks_for_all_layers.reserve(effective_num_layers);
-                    if (m_enable_prefix_caching) {
-                        auto hash = sequence->get_hash();
-                        new_blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
-                    } else {
-                        for (size_t i = 0; i < effective_num_layers; i++) {
-                            new_blocks_for_all_layers.push_back(m_allocator.allocate_block(i));
-                        }
-                    }
-
-                    for (size_t i = 0; i < effective_num_layers; i++) {
-                        auto& new_block = new_blocks_for_all_layers[i];
-                        auto& block_table = m_block_table[seq_id][i];
-                        block_table[num_physical_blocks - 1] = new_blocks_for_all_layers[i];
-                        auto& last_block = last_blocks[i];
-                        copy_blocks_map[last_block->get_index()].push_back(new_block->get_index());
-                    }
-                    m_allocator.free(last_blocks, m_prefix_hash_to_occupied_block_map);
+                    _copy_last_block_on_write(sequence, copy_blocks_map);
                 } else {
                     // we are the only users of this block
                     if (m_enable_prefix_caching) {
@@ -1108,10 +1307,41 @@ public:
         return copy_blocks_map;
     }
 
+    /**
+     * Restores leading fully filled blocks of a sequence from the prefix cache, e.g. when the sequence is swapped
+     * back into KV cache. Restoring stops at the first block which is not cached.
+     * @param sequence The sequence without a block table.
+     * @param num_full_blocks The number of leading blocks of the sequence which are completely filled with processed tokens.
+     * @return The number of restored blocks, they start the block table of the sequence.
+     */
+    size_t restore_cached_blocks(Sequence::Ptr sequence, size_t num_full_blocks) {
+        OPENVINO_ASSERT(m_enable_prefix_caching);
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto seq_id = sequence->get_id();
+        OPENVINO_ASSERT(m_block_table.find(seq_id) == m_block_table.end(), "Sequence ", seq_id, " already has a block table");
+
+        std::vector<BlocksPerLayer> block_table(m_num_layers);
+        size_t num_restored_blocks = 0;
+        for (; num_restored_blocks < num_full_blocks; ++num_restored_blocks) {
+            auto hash = sequence->get_hash((num_restored_blocks + 1) * m_block_size);
+            auto blocks = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
+            if (blocks.empty()) {
+                break;
+            }
+            for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                block_table[layer_idx].push_back(blocks[layer_idx]);
+            }
+        }
+        if (num_restored_blocks > 0) {
+            m_block_table[seq_id] = std::move(block_table);
+        }
+        return num_restored_blocks;
+    }
+
     void restore_cached_blocks(SequenceGroup::Ptr group) {
         // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
         // The mutex is needed to prevent such segfaults.
-        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::unique_lock<std::mutex> lock(m_cached_blocks_map_mutex);
         auto prompt_len = group->get_prompt_len();
         auto sequences = group->get_not_finished_sequences();
         OPENVINO_ASSERT(sequences.size() == 1);
@@ -1133,12 +1363,12 @@ public:
             // restore fully filled blocks
             auto full_block_hash = sequence->get_hash(content_len);
             auto blocks = m_allocator.get_cached_block(full_block_hash, m_prefix_hash_to_occupied_block_map);
-            auto timestamp = std::chrono::steady_clock::now();
+            if (blocks.empty() && content_len - prev_iteration_content_len == m_block_size) {
+                blocks = _restore_spilled_block(full_block_hash, lock);
+            }
             if (!blocks.empty()) {
                 for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
-                    auto& block = blocks[layer_idx];
-                    block->set_timestamp(timestamp);
-                    block_table[layer_idx].push_back(block);
+                    block_table[layer_idx].push_back(blocks[layer_idx]);
                 }
                 group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
             } else {
@@ -1150,12 +1380,8 @@ public:
                     auto hash = sequence->get_hash(prev_iteration_content_len + i);
                     auto blocks = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
                     if (!blocks.empty()) {
-                        auto timestamp = std::chrono::steady_clock::now();
-
                         for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
-                            auto& block = blocks[layer_idx];
-                            block->set_timestamp(timestamp);
-                            block_table[layer_idx].push_back(block);
+                            block_table[layer_idx].push_back(blocks[layer_idx]);
                         }
                         group->update_processed_tokens_num(prev_iteration_content_len + i == prompt_len ? prev_iteration_content_len + i - 1 : prev_iteration_content_len + i);
 
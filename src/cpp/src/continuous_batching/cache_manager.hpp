@@ -5,8 +5,12 @@
 
 #include <vector>
 #include <list>
+#include <cstring>
+#include <sstream>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "continuous_batching/reserved_host_memory.hpp"
 #include "utils.hpp"
 namespace ov::genai {
 
@@ -17,7 +21,11 @@ class CacheManager {
     std::vector<ov::element::Type> m_key_precisions, m_value_precisions;
     std::vector<ov::PartialShape> m_key_shapes, m_value_shapes;
     std::vector<ov::Tensor> m_key_cache, m_value_cache;
+    // per-layer address space reserved for KV cache growth in host memory, see `reserve_host_cache`
+    std::vector<std::shared_ptr<ReservedHostMemory>> m_key_reserved_memory, m_value_reserved_memory;
     size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
+    // identity of the model which fills KV cache, see `set_model_fingerprint`
+    uint64_t m_model_fingerprint = 0;
     ov::InferRequest m_request;
     ov::RemoteContext m_context;
 
@@ -31,6 +39,84 @@ class CacheManager {
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
     }
 
+    static size_t _get_block_stride(const ov::PartialShape& pshape, ov::element::Type precision) {
+        size_t num_elements = 1;
+        for (size_t dim = 1; dim < pshape.size(); ++dim) {
+            num_elements *= pshape[dim].get_length();
+        }
+        return (num_elements * precision.bitwidth() + 7) / 8;
+    }
+
+    static ov::Tensor _create_in_reserved_memory(const std::shared_ptr<ReservedHostMemory>& memory, ov::element::Type precision, const ov::Shape& shape) {
+        // commit before creating the tensor, so that a lack of memory is reported as std::bad_alloc
+        memory->commit((ov::shape_size(shape) * precision.bitwidth() + 7) / 8);
+        return ov::Tensor(precision, shape, ov::Allocator(ReservedHostMemoryAllocator{memory}));
+    }
+
+    bool _can_grow_in_place(size_t num_kv_blocks) const {
+        if (m_key_reserved_memory.empty()) {
+            return false;
+        }
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            if (_get_block_stride(m_key_shapes[decoder_layer_id], m_key_precisions[decoder_layer_id]) * num_kv_blocks > m_key_reserved_memory[decoder_layer_id]->get_capacity() ||
+                _get_block_stride(m_value_shapes[decoder_layer_id], m_value_precisions[decoder_layer_id]) * num_kv_blocks > m_value_reserved_memory[decoder_layer_id]->get_capacity()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Copies the first `num_tokens` token positions of a block, if the block layout is [num_heads, block_size, row]
+     * with rows taking whole bytes; otherwise copies the whole block.
+     */
+    void _copy_block_prefix(const ov::Shape& shape, ov::element::Type precision, const uint8_t* src, uint8_t* dst,
+                            size_t block_stride, size_t num_tokens) const {
+        const bool is_token_major = shape.size() == 4 && shape[2] == m_block_size && (shape[3] * precision.bitwidth()) % 8 == 0;
+        if (!is_token_major || num_tokens >= m_block_size) {
+            std::memcpy(dst, src, block_stride);
+            return;
+        }
+        const size_t row_size = shape[3] * precision.bitwidth() / 8;
+        const size_t head_size = m_block_size * row_size;
+        for (size_t head = 0; head < shape[1]; ++head) {
+            std::memcpy(dst + head * head_size, src + head * head_size, num_tokens * row_size);
+        }
+    }
+
+    static void _copy_remote_blocks(const ov::Tensor& cache, const std::vector<std::pair<size_t, size_t>>& block_pairs) {
+        const ov::element::Type precision = cache.get_element_type();
+        if (precision == ov::element::u4 || precision == ov::element::i4) {
+            // ROI tensors can't address sub-byte remote tensors
+            return;
+        }
+        const ov::Shape shape = cache.get_shape();
+        for (const auto& [src_block_id, dst_block_id] : block_pairs) {
+            ov::Coordinate src_start(shape.size(), 0), src_end = shape, dst_start(shape.size(), 0), dst_end = shape;
+            src_end[0] = (src_start[0] = src_block_id) + 1;
+            dst_end[0] = (dst_start[0] = dst_block_id) + 1;
+            ov::Tensor src_roi(cache, src_start, src_end);
+            ov::Tensor dst_roi(cache, dst_start, dst_end);
+            src_roi.copy_to(dst_roi);
+        }
+    }
+
+    template <typename Func>
+    void _transfer_block(const std::vector<size_t>& block_indices, Func&& func) const {
+        OPENVINO_ASSERT(is_host_cache(), "KV cache block transfer is supported only for caches allocated in host memory");
+        OPENVINO_ASSERT(block_indices.size() == 1 || block_indices.size() == m_num_decoder_layers,
+                        "Expected one block index or one per decoder layer, got ", block_indices.size());
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            size_t block_id = block_indices.size() == 1 ? block_indices[0] : block_indices[decoder_layer_id];
+            OPENVINO_ASSERT(block_id < m_num_allocated_kv_blocks, "Block index ", block_id, " is out of allocated KV cache range");
+            size_t key_stride = _get_block_stride(m_key_shapes[decoder_layer_id], m_key_precisions[decoder_layer_id]);
+            size_t value_stride = _get_block_stride(m_value_shapes[decoder_layer_id], m_value_precisions[decoder_layer_id]);
+            ov::Tensor key_cache = m_key_cache[decoder_layer_id], value_cache = m_value_cache[decoder_layer_id];
+            func(static_cast<uint8_t*>(key_cache.data()) + block_id * key_stride, key_stride);
+            func(static_cast<uint8_t*>(value_cache.data()) + block_id * value_stride, value_stride);
+        }
+    }
+
 public:
     explicit CacheManager(ov::InferRequest request) :
         m_request(request) {
@@ -123,6 +209,30 @@ public:
         return 1;
     }
 
+    /**
+     * Reserves address space for up to `max_num_kv_blocks` KV cache blocks in host memory without committing it.
+     * Afterwards `allocate_cache_if_needed` grows the cache in place: only the memory for new blocks is committed,
+     * existing blocks are neither reallocated nor copied. Growing beyond the reservation falls back to reallocation.
+     * Has no effect for caches allocated in device memory or once the cache is allocated.
+     */
+    void reserve_host_cache(size_t max_num_kv_blocks) {
+        if (!is_host_cache() || m_num_allocated_kv_blocks > 0 || max_num_kv_blocks == 0) {
+            return;
+        }
+        try {
+            for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                size_t key_stride = _get_block_stride(m_key_shapes[decoder_layer_id], m_key_precisions[decoder_layer_id]);
+                size_t value_stride = _get_block_stride(m_value_shapes[decoder_layer_id], m_value_precisions[decoder_layer_id]);
+                m_key_reserved_memory.push_back(std::make_shared<ReservedHostMemory>(key_stride * max_num_kv_blocks));
+                m_value_reserved_memory.push_back(std::make_shared<ReservedHostMemory>(value_stride * max_num_kv_blocks));
+            }
+        } catch (const std::bad_alloc&) {
+            // not enough address space, the cache is reallocated on growth instead
+            m_key_reserved_memory.clear();
+            m_value_reserved_memory.clear();
+        }
+    }
+
     void allocate_cache_if_needed(size_t num_kv_blocks) {
         if (m_num_allocated_kv_blocks >= num_kv_blocks) {
             return;
@@ -161,9 +271,30 @@ public:
                         m_value_cache.emplace_back(value_cache);
                     }
 
+                    update_request_tensor(decoder_layer_id);
+                }
+            } else if (_can_grow_in_place(num_kv_blocks)) {
+                // new tensors extend the old ones over the same memory, so the existing blocks stay in place
+                for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                    ov::Tensor key_cache = _create_in_reserved_memory(m_key_reserved_memory[decoder_layer_id],
+                        get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks));
+                    ov::Tensor value_cache = _create_in_reserved_memory(m_value_reserved_memory[decoder_layer_id],
+                        get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks));
+
+                    if (m_key_cache.size() > decoder_layer_id) {
+                        m_key_cache[decoder_layer_id] = key_cache;
+                        m_value_cache[decoder_layer_id] = value_cache;
+                    } else {
+                        m_key_cache.emplace_back(key_cache);
+                        m_value_cache.emplace_back(value_cache);
+                    }
+
                     update_request_tensor(decoder_layer_id);
                 }
             } else {
+                // the reservation (if any) is exceeded, the cache is copied out of it below
+                m_key_reserved_memory.clear();
+                m_value_reserved_memory.clear();
                 for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
                     ov::Shape value_cache_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks);
                     ov::Shape key_cache_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks);
@@ -219,6 +350,9 @@ public:
                 }
             }
         }
+        catch (const std::bad_alloc&) {
+            OPENVINO_THROW("Requested KV-cache size is larger than available memory size on the system.");
+        }
         catch (ov::Exception& e) {
             if (std::string(e.what()).find("bad allocation") != std::string::npos) {
                 OPENVINO_THROW("Requested KV-cache size is larger than available memory size on the system.");
@@ -242,63 +376,119 @@ public:
         return m_value_shapes[layer_id][3].get_length();
     }
 
-    void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
-        for (const auto & blocks_pair : block_copy_map) {
-            size_t src_block_id = blocks_pair.first;
-            const std::list<size_t>& dst_block_ids = blocks_pair.second;
+    /**
+     * Copies the contents of KV cache blocks for all decoder layers, e.g. when sequences are forked.
+     * @param block_copy_map Destination block indices for each source block index.
+     * @param block_num_filled_tokens Number of leading token positions holding data for source blocks which are
+     * only partially filled (e.g. the last block shared by forked sequences). Only these positions are copied from
+     * host caches; blocks without an entry are copied entirely.
+     */
+    void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map, const std::map<size_t, size_t>& block_num_filled_tokens = {}) {
+        std::vector<std::pair<size_t, size_t>> block_pairs;
+        std::vector<size_t> pair_num_tokens;
+        for (const auto& [src_block_id, dst_block_ids] : block_copy_map) {
+            auto num_tokens_it = block_num_filled_tokens.find(src_block_id);
+            const size_t num_tokens = num_tokens_it == block_num_filled_tokens.end() ? m_block_size : std::min(num_tokens_it->second, m_block_size);
+            if (num_tokens == 0 && is_host_cache()) {
+                // nothing was written to the block yet
+                continue;
+            }
             for (size_t dst_block_id : dst_block_ids) {
-                for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
-                    ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Coordinate key_src_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_src_end_roi = key_shape;
-                    ov::Coordinate key_dst_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_dst_end_roi = key_shape;
-
-                    ov::Coordinate value_src_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_src_end_roi = value_shape;
-                    ov::Coordinate value_dst_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_dst_end_roi = value_shape;
-                    key_src_end_roi[0] = (key_src_start_roi[0] = src_block_id) + 1;
-                    value_src_end_roi[0] = (value_src_start_roi[0] = src_block_id) + 1;
-                    key_dst_end_roi[0] = (key_dst_start_roi[0] = dst_block_id) + 1;
-                    value_dst_end_roi[0] = (value_dst_start_roi[0] = dst_block_id) + 1;
-
-                    auto copy_one_block = [&](ov::Tensor& dst, const ov::Tensor& src, size_t src_start, size_t dst_start, size_t stride) {
-                        const bool is_remote = dst.is<ov::RemoteTensor>() || src.is<ov::RemoteTensor>();
-                        if (is_remote) {
-                            return;
-                        }
-                        auto sub_byte_multipyer = sub_byte_data_type_multiplier(dst.get_element_type());
-                        OPENVINO_SUPPRESS_DEPRECATED_START
-                        const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(src.data()) + src_start * stride;
-                        uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst.data()) + dst_start * stride;
-                        OPENVINO_SUPPRESS_DEPRECATED_END
-                        std::memcpy(dst_ptr, src_ptr, 1 * stride);
-                    };
-
-                    const auto& key_cache_prec = m_key_cache[decoder_layer_id].get_element_type();
-                    if (key_cache_prec == ov::element::u4 || key_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(key_shape.begin()), key_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_key_cache[decoder_layer_id], m_key_cache[decoder_layer_id], key_src_start_roi[0], key_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor key_src_cache_roi(m_key_cache[decoder_layer_id], key_src_start_roi, key_src_end_roi);
-                        ov::Tensor key_dst_cache_roi(m_key_cache[decoder_layer_id], key_dst_start_roi, key_dst_end_roi);
-                        key_src_cache_roi.copy_to(key_dst_cache_roi);
-                    }
-
-                    const auto& value_cache_prec = m_value_cache[decoder_layer_id].get_element_type();
-                    if (value_cache_prec == ov::element::u4 || value_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(value_shape.begin()), value_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_value_cache[decoder_layer_id], m_value_cache[decoder_layer_id], value_src_start_roi[0], value_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor value_src_cache_roi(m_value_cache[decoder_layer_id], value_src_start_roi, value_src_end_roi);
-                        ov::Tensor value_dst_cache_roi(m_value_cache[decoder_layer_id], value_dst_start_roi, value_dst_end_roi);
-                        value_src_cache_roi.copy_to(value_dst_cache_roi);
-                    }
-                }
+                block_pairs.emplace_back(src_block_id, dst_block_id);
+                pair_num_tokens.push_back(num_tokens);
             }
         }
+        if (block_pairs.empty()) {
+            return;
+        }
+
+        if (is_host_cache()) {
+            // copy raw block strides, distributing key and value caches of all layers and block pairs among threads
+            ov::parallel_for2d(2 * m_num_decoder_layers, block_pairs.size(), [&](size_t cache_id, size_t pair_id) {
+                const size_t decoder_layer_id = cache_id / 2;
+                const bool is_key = cache_id % 2 == 0;
+                const ov::Tensor& cache = is_key ? m_key_cache[decoder_layer_id] : m_value_cache[decoder_layer_id];
+                const size_t stride = is_key ? _get_block_stride(m_key_shapes[decoder_layer_id], m_key_precisions[decoder_layer_id])
+                                             : _get_block_stride(m_value_shapes[decoder_layer_id], m_value_precisions[decoder_layer_id]);
+                uint8_t* data = static_cast<uint8_t*>(cache.data());
+                const auto [src_block_id, dst_block_id] = block_pairs[pair_id];
+                _copy_block_prefix(cache.get_shape(), cache.get_element_type(), data + src_block_id * stride, data + dst_block_id * stride,
+                                   stride, pair_num_tokens[pair_id]);
+            });
+            return;
+        }
+
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            _copy_remote_blocks(m_key_cache[decoder_layer_id], block_pairs);
+            _copy_remote_blocks(m_value_cache[decoder_layer_id], block_pairs);
+        }
+    }
+
+    /**
+     * @return Whether KV cache tensors are allocated in host memory and can be accessed directly.
+     */
+    bool is_host_cache() const {
+        return !m_context;
+    }
+
+    /**
+     * @return The exact size in bytes of the contents of a single KV cache block across all decoder layers,
+     * i.e. the amount of data transferred by `export_block` / `import_block`.
+     */
+    size_t get_block_contents_size_in_bytes() const {
+        size_t size = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            size += _get_block_stride(m_key_shapes[decoder_layer_id], m_key_precisions[decoder_layer_id]);
+            size += _get_block_stride(m_value_shapes[decoder_layer_id], m_value_precisions[decoder_layer_id]);
+        }
+        return size;
+    }
+
+    /**
+     * Sets identity of the model (see utils::get_model_fingerprint) to be mixed into `get_layout_fingerprint`,
+     * as KV cache contents of models with the same layout, but different weights, are not interchangeable.
+     */
+    void set_model_fingerprint(uint64_t model_fingerprint) {
+        m_model_fingerprint = model_fingerprint;
+    }
+
+    /**
+     * @return A process-independent hash of the model identity and the KV cache layout (block size, number of layers,
+     * per-layer shapes and precisions). Blocks persisted for one model or layout must not be restored into another cache.
+     */
+    uint64_t get_layout_fingerprint() const {
+        std::ostringstream layout;
+        layout << m_block_size << ";" << m_num_decoder_layers;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            layout << ";k:" << m_key_precisions[decoder_layer_id].get_type_name() << m_key_shapes[decoder_layer_id].to_string()
+                   << ";v:" << m_value_precisions[decoder_layer_id].get_type_name() << m_value_shapes[decoder_layer_id].to_string();
+        }
+        const std::string layout_str = layout.str();
+        return utils::stable_hash(layout_str.data(), layout_str.size(), m_model_fingerprint);
+    }
+
+    /**
+     * Copies the contents of a KV cache block for all decoder layers (keys, then values, layer by layer) into a host buffer.
+     * @param block_indices Physical block index for each decoder layer, or a single index shared by all layers.
+     * @param dst Destination buffer of `get_block_contents_size_in_bytes()` bytes.
+     */
+    void export_block(const std::vector<size_t>& block_indices, uint8_t* dst) const {
+        _transfer_block(block_indices, [&dst](uint8_t* block_ptr, size_t stride) {
+            std::memcpy(dst, block_ptr, stride);
+            dst += stride;
+        });
+    }
+
+    /**
+     * Overwrites the contents of a KV cache block for all decoder layers with data previously produced by `export_block`.
+     * @param block_indices Physical block index for each decoder layer, or a single index shared by all layers.
+     * @param src Source buffer of `get_block_contents_size_in_bytes()` bytes.
+     */
+    void import_block(const std::vector<size_t>& block_indices, const uint8_t* src) {
+        _transfer_block(block_indices, [&src](uint8_t* block_ptr, size_t stride) {
+            std::memcpy(block_ptr, src, stride);
+            src += stride;
+        });
     }
 
     void clear() {
@@ -306,6 +496,10 @@ public:
             m_key_cache[decoder_layer_id] = ov::Tensor();
             m_value_cache[decoder_layer_id] = ov::Tensor();
         }
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_key_reserved_memory.size(); ++decoder_layer_id) {
+            m_key_reserved_memory[decoder_layer_id]->decommit();
+            m_value_reserved_memory[decoder_layer_id]->decommit();
+        }
         m_num_allocated_kv_blocks = 0;
     }
 };
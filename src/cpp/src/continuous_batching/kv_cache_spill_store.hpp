@@ -0,0 +1,435 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief A pending data movement between the KV cache tensors and the spill store.
+ * SPILL transfers copy the contents of the given blocks into the store when executed, RESTORE transfers
+ * carry the block contents that were already read from the store and must be written into the given blocks.
+ */
+struct KVCacheSpillTransfer {
+    enum class Direction { SPILL, RESTORE };
+    Direction direction;
+    uint64_t hash;
+    // physical block index for each layer
+    std::vector<size_t> block_indices;
+    // block contents for RESTORE transfers
+    std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Second-tier, persistent storage for prefix-cached KV blocks.
+ *
+ * Blocks that are about to be overwritten in the in-memory prefix cache are written into a file of fixed-size slots,
+ * addressed by the stable content hash of the block (see Sequence::get_hash). Blocks found in the file can be restored
+ * into fresh KV cache blocks instead of being recomputed, also by a different process, as long as the file was
+ * produced for the same KV cache layout (checked with a fingerprint stored in the file header).
+ * When the file is full, the oldest written slot is overwritten.
+ * Blocks passed to `write_async` are written by a background thread, so that disk I/O does not stall scheduling.
+ */
+class KVCacheSpillStore {
+    static constexpr char MAGIC[8] = {'O', 'V', 'G', 'K', 'V', 'S', 'P', '1'};
+    static constexpr uint64_t SLOT_VALID = 0x4b56424c4f434b31ULL;
+    // upper bound of block buffers kept for reuse by `acquire_buffer`
+    static constexpr size_t MAX_FREE_BUFFERS = 16;
+    // upper bound of blocks waiting for the background writer, `write_async` blocks when it is reached
+    static constexpr size_t MAX_QUEUED_WRITES = 16;
+
+    struct FileHeader {
+        char magic[8];
+        uint64_t fingerprint;
+        uint64_t block_size_in_bytes;
+        uint64_t num_slots;
+    };
+
+    struct SlotHeader {
+        uint64_t hash;
+        uint64_t valid;
+    };
+
+    struct QueuedWrite {
+        uint64_t hash;
+        std::vector<uint8_t> data;
+    };
+
+    std::filesystem::path m_path;
+    std::fstream m_file;
+    uint64_t m_fingerprint;
+    size_t m_block_size_in_bytes;
+    size_t m_num_slots;
+    size_t m_next_slot = 0;
+    // hash -> slot index
+    std::unordered_map<uint64_t, size_t> m_slot_by_hash;
+    // slot index -> hash of the block currently stored in it (valid only for occupied slots)
+    std::vector<uint64_t> m_hash_by_slot;
+    std::vector<bool> m_is_slot_occupied;
+    std::vector<KVCacheSpillTransfer> m_pending_transfers;
+    // buffers of executed RESTORE transfers to be reused by next reads
+    std::vector<std::vector<uint8_t>> m_free_buffers;
+    // blocks waiting for the background writer; the front one stays in the queue until it is written
+    std::deque<QueuedWrite> m_write_queue;
+    std::exception_ptr m_write_error;
+    bool m_stop_writer = false;
+    // guards the index, queues and buffers
+    mutable std::mutex m_mutex;
+    // serializes file I/O, must be acquired before m_mutex when both are held
+    std::mutex m_file_mutex;
+    std::condition_variable m_write_queue_cv;
+    std::condition_variable m_write_done_cv;
+    std::thread m_writer;
+
+    std::streamoff _slot_offset(size_t slot_idx) const {
+        return static_cast<std::streamoff>(sizeof(FileHeader) + slot_idx * (sizeof(SlotHeader) + m_block_size_in_bytes));
+    }
+
+    void _write_slot_header(size_t slot_idx, const SlotHeader& slot_header) {
+        m_file.seekp(_slot_offset(slot_idx));
+        m_file.write(reinterpret_cast<const char*>(&slot_header), sizeof(slot_header));
+    }
+
+    bool _try_load_index() {
+        std::ifstream in(m_path, std::ios::binary);
+        if (!in.is_open()) {
+            return false;
+        }
+        FileHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            header.fingerprint != m_fingerprint ||
+            header.block_size_in_bytes != m_block_size_in_bytes ||
+            header.num_slots != m_num_slots) {
+            return false;
+        }
+        for (size_t slot_idx = 0; slot_idx < m_num_slots; ++slot_idx) {
+            SlotHeader slot_header;
+            in.seekg(_slot_offset(slot_idx));
+            if (!in.read(reinterpret_cast<char*>(&slot_header), sizeof(slot_header))) {
+                return false;
+            }
+            if (slot_header.valid == SLOT_VALID) {
+                m_slot_by_hash[slot_header.hash] = slot_idx;
+                m_hash_by_slot[slot_idx] = slot_header.hash;
+                m_is_slot_occupied[slot_idx] = true;
+                m_next_slot = slot_idx + 1;
+            }
+        }
+        m_next_slot %= m_num_slots;
+        return true;
+    }
+
+    void _create_file() {
+        std::ofstream out(m_path, std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(out.is_open(), "Cannot create KV cache spill file ", m_path.string());
+        FileHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.fingerprint = m_fingerprint;
+        header.block_size_in_bytes = m_block_size_in_bytes;
+        header.num_slots = m_num_slots;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        // mark all slots as empty
+        const SlotHeader empty_slot{0, 0};
+        for (size_t slot_idx = 0; slot_idx < m_num_slots; ++slot_idx) {
+            out.seekp(_slot_offset(slot_idx));
+            out.write(reinterpret_cast<const char*>(&empty_slot), sizeof(empty_slot));
+        }
+        OPENVINO_ASSERT(out.good(), "Cannot initialize KV cache spill file ", m_path.string());
+    }
+
+    bool _is_write_queued(uint64_t hash) const {
+        return std::any_of(m_write_queue.begin(), m_write_queue.end(), [hash](const QueuedWrite& queued) {
+            return queued.hash == hash;
+        });
+    }
+
+    void _rethrow_write_error() {
+        if (m_write_error) {
+            std::rethrow_exception(std::exchange(m_write_error, nullptr));
+        }
+    }
+
+    // requires m_file_mutex to be held
+    void _write_to_file(uint64_t hash, const uint8_t* data) {
+        size_t slot_idx;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_slot_by_hash.count(hash)) {
+                return;
+            }
+            slot_idx = _allocate_slot();
+        }
+        // invalidate the slot first so that an interrupted write does not leave a valid-looking slot behind
+        _write_slot_header(slot_idx, {0, 0});
+        m_file.write(reinterpret_cast<const char*>(data), m_block_size_in_bytes);
+        _write_slot_header(slot_idx, {hash, SLOT_VALID});
+        m_file.flush();
+        OPENVINO_ASSERT(m_file.good(), "Failed to write KV cache spill file ", m_path.string());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_slot_by_hash[hash] = slot_idx;
+        m_hash_by_slot[slot_idx] = hash;
+        m_is_slot_occupied[slot_idx] = true;
+    }
+
+    void _run_writer() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_write_queue_cv.wait(lock, [this] { return m_stop_writer || !m_write_queue.empty(); });
+            if (m_write_queue.empty()) {
+                return;
+            }
+            // references to deque elements stay valid while other blocks are appended
+            const QueuedWrite& queued = m_write_queue.front();
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                std::lock_guard<std::mutex> file_lock(m_file_mutex);
+                _write_to_file(queued.hash, queued.data.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error && !m_write_error) {
+                m_write_error = error;
+            }
+            if (m_free_buffers.size() < MAX_FREE_BUFFERS) {
+                m_free_buffers.push_back(std::move(m_write_queue.front().data));
+            }
+            m_write_queue.pop_front();
+            m_write_done_cv.notify_all();
+        }
+    }
+
+    size_t _allocate_slot() {
+        size_t slot_idx = m_next_slot;
+        m_next_slot = (m_next_slot + 1) % m_num_slots;
+        if (m_is_slot_occupied[slot_idx]) {
+            m_slot_by_hash.erase(m_hash_by_slot[slot_idx]);
+            m_is_slot_occupied[slot_idx] = false;
+        }
+        return slot_idx;
+    }
+
+public:
+    /**
+     * Opens the spill file at the given path, reusing its contents if they were produced for the same KV cache layout,
+     * or (re-)creates an empty one otherwise.
+     * @param path Path to the spill file.
+     * @param max_size_in_bytes Upper bound of the spill file size; determines the number of slots.
+     * @param block_size_in_bytes The size of the contents of one KV cache block across all layers, in bytes.
+     * @param fingerprint A hash describing the KV cache layout of the model (see CacheManager::get_layout_fingerprint).
+     */
+    KVCacheSpillStore(const std::filesystem::path& path, size_t max_size_in_bytes, size_t block_size_in_bytes, uint64_t fingerprint) :
+            m_path(path), m_fingerprint(fingerprint), m_block_size_in_bytes(block_size_in_bytes) {
+        OPENVINO_ASSERT(block_size_in_bytes > 0, "KV cache block size must be non-zero");
+        OPENVINO_ASSERT(max_size_in_bytes > sizeof(FileHeader), "KV cache spill file size is too small");
+        m_num_slots = (max_size_in_bytes - sizeof(FileHeader)) / (sizeof(SlotHeader) + block_size_in_bytes);
+        OPENVINO_ASSERT(m_num_slots > 0, "KV cache spill file size is too small to hold a single KV cache block");
+        m_hash_by_slot.resize(m_num_slots, 0);
+        m_is_slot_occupied.resize(m_num_slots, false);
+
+        if (!_try_load_index()) {
+            m_slot_by_hash.clear();
+            std::fill(m_is_slot_occupied.begin(), m_is_slot_occupied.end(), false);
+            m_next_slot = 0;
+            _create_file();
+        }
+        m_file.open(m_path, std::ios::binary | std::ios::in | std::ios::out);
+        OPENVINO_ASSERT(m_file.is_open(), "Cannot open KV cache spill file ", m_path.string());
+        m_writer = std::thread(&KVCacheSpillStore::_run_writer, this);
+    }
+
+    KVCacheSpillStore(const KVCacheSpillStore&) = delete;
+    KVCacheSpillStore& operator=(const KVCacheSpillStore&) = delete;
+
+    /**
+     * Writes the queued blocks to the file before closing it.
+     */
+    ~KVCacheSpillStore() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop_writer = true;
+        }
+        m_write_queue_cv.notify_one();
+        m_writer.join();
+    }
+
+    size_t get_block_size_in_bytes() const {
+        return m_block_size_in_bytes;
+    }
+
+    /**
+     * @return The maximum number of blocks which can be stored in the spill file.
+     */
+    size_t capacity() const {
+        return m_num_slots;
+    }
+
+    /**
+     * @return The number of blocks currently stored in the spill file.
+     */
+    size_t num_blocks() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_slot_by_hash.size();
+    }
+
+    /**
+     * @return Whether the block is stored in the spill file or queued for writing.
+     */
+    bool contains(uint64_t hash) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_slot_by_hash.count(hash) != 0 || _is_write_queued(hash);
+    }
+
+    /**
+     * Stores the contents of a block under the given hash, overwriting the oldest slot if the file is full.
+     * @param hash The content hash of the block.
+     * @param data Block contents, `get_block_size_in_bytes()` bytes.
+     */
+    void write(uint64_t hash, const uint8_t* data) {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        _write_to_file(hash, data);
+    }
+
+    /**
+     * Queues the contents of a block to be stored by the background writer, waiting if too many blocks are queued already.
+     * The block is visible to `contains` and `read` immediately.
+     * @param hash The content hash of the block.
+     * @param data Block contents, `get_block_size_in_bytes()` bytes, preferably obtained with `acquire_buffer`.
+     */
+    void write_async(uint64_t hash, std::vector<uint8_t> data) {
+        OPENVINO_ASSERT(data.size() == m_block_size_in_bytes, "Unexpected size of KV cache block contents to spill");
+        std::unique_lock<std::mutex> lock(m_mutex);
+        _rethrow_write_error();
+        if (m_slot_by_hash.count(hash) || _is_write_queued(hash)) {
+            if (m_free_buffers.size() < MAX_FREE_BUFFERS) {
+                m_free_buffers.push_back(std::move(data));
+            }
+            return;
+        }
+        m_write_done_cv.wait(lock, [this] { return m_write_queue.size() < MAX_QUEUED_WRITES; });
+        m_write_queue.push_back({hash, std::move(data)});
+        m_write_queue_cv.notify_one();
+    }
+
+    /**
+     * Waits until all blocks queued with `write_async` are written to the file.
+     */
+    void wait_for_writes() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_write_done_cv.wait(lock, [this] { return m_write_queue.empty(); });
+        _rethrow_write_error();
+    }
+
+    /**
+     * Reads the contents of a block stored under the given hash.
+     * @param hash The content hash of the block.
+     * @param data Destination buffer, `get_block_size_in_bytes()` bytes.
+     * @return Whether the block was found in the store.
+     */
+    bool read(uint64_t hash, uint8_t* data) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = std::find_if(m_write_queue.begin(), m_write_queue.end(), [hash](const QueuedWrite& queued) {
+                return queued.hash == hash;
+            });
+            if (it != m_write_queue.end()) {
+                std::memcpy(data, it->data.data(), m_block_size_in_bytes);
+                return true;
+            }
+        }
+        // the writer updates the index before removing a block from the queue, so a block cannot be missed in between
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        size_t slot_idx;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_slot_by_hash.find(hash);
+            if (it == m_slot_by_hash.end()) {
+                return false;
+            }
+            slot_idx = it->second;
+        }
+        m_file.seekg(_slot_offset(slot_idx) + static_cast<std::streamoff>(sizeof(SlotHeader)));
+        m_file.read(reinterpret_cast<char*>(data), m_block_size_in_bytes);
+        OPENVINO_ASSERT(m_file.good(), "Failed to read KV cache spill file ", m_path.string());
+        return true;
+    }
+
+    /**
+     * @return A buffer of `get_block_size_in_bytes()` bytes for `read`, reusing one returned by `release_buffer` if possible.
+     */
+    std::vector<uint8_t> acquire_buffer() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free_buffers.empty()) {
+            return std::vector<uint8_t>(m_block_size_in_bytes);
+        }
+        std::vector<uint8_t> buffer = std::move(m_free_buffers.back());
+        m_free_buffers.pop_back();
+        return buffer;
+    }
+
+    /**
+     * Returns a buffer obtained with `acquire_buffer` (e.g. the data of an executed RESTORE transfer) for reuse.
+     */
+    void release_buffer(std::vector<uint8_t> buffer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (buffer.size() == m_block_size_in_bytes && m_free_buffers.size() < MAX_FREE_BUFFERS) {
+            m_free_buffers.push_back(std::move(buffer));
+        }
+    }
+
+    /**
+     * Records that the blocks with the given indices are about to be overwritten and their contents should be spilled.
+     * The copy is performed by the consumer of `take_pending_transfers` before the next inference modifies the KV cache.
+     * @param hash The content hash of the blocks.
+     * @param block_indices Physical block index for each layer.
+     */
+    void schedule_spill(uint64_t hash, std::vector<size_t> block_indices) {
+        if (contains(hash)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending_transfers.push_back({KVCacheSpillTransfer::Direction::SPILL, hash, std::move(block_indices), {}});
+    }
+
+    /**
+     * Records that previously read block contents should be written into the blocks with the given indices.
+     * @param hash The content hash of the block.
+     * @param block_indices Physical block index for each layer.
+     * @param data Block contents obtained with `read`.
+     */
+    void schedule_restore(uint64_t hash, std::vector<size_t> block_indices, std::vector<uint8_t> data) {
+        OPENVINO_ASSERT(data.size() == m_block_size_in_bytes, "Unexpected size of KV cache block contents to restore");
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending_transfers.push_back({KVCacheSpillTransfer::Direction::RESTORE, hash, std::move(block_indices), std::move(data)});
+    }
+
+    /**
+     * @return Transfers scheduled since the last call, in the order they must be executed.
+     */
+    std::vector<KVCacheSpillTransfer> take_pending_transfers() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<KVCacheSpillTransfer> transfers;
+        transfers.swap(m_pending_transfers);
+        return transfers;
+    }
+};
+
+}
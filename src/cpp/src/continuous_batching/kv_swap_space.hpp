@@ -0,0 +1,137 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Host memory pool holding the KV cache blocks of sequences preempted with PreemptionMode::SWAP.
+ *
+ * The pool consists of fixed-size slots, each holding the contents of one KV cache block for all decoder layers
+ * (as produced by CacheManager::export_block). Slot buffers are allocated on first use and reused afterwards, so
+ * the pool never takes more memory than the largest amount of simultaneously swapped out blocks.
+ * Swapped out blocks are tracked per request; a request is swapped in as a whole.
+ */
+class KVCacheSwapSpace {
+public:
+    struct SwappedSequence {
+        uint64_t sequence_id;
+        // slot index for each logical block of the sequence
+        std::vector<size_t> slots;
+    };
+
+    /**
+     * @param max_size_in_bytes Upper bound for the memory taken by the slots.
+     * @param block_size_in_bytes Size of the contents of a single KV cache block for all decoder layers.
+     */
+    KVCacheSwapSpace(size_t max_size_in_bytes, size_t block_size_in_bytes) :
+            m_block_size_in_bytes(block_size_in_bytes),
+            m_max_num_slots(block_size_in_bytes > 0 ? max_size_in_bytes / block_size_in_bytes : 0) {
+        OPENVINO_ASSERT(m_block_size_in_bytes > 0, "KV cache block size must be non-zero");
+        OPENVINO_ASSERT(m_max_num_slots > 0, "swap_space_size is too small to hold a single KV cache block of ", m_block_size_in_bytes, " bytes");
+    }
+
+    size_t get_block_size_in_bytes() const {
+        return m_block_size_in_bytes;
+    }
+
+    size_t get_num_free_slots() const {
+        return m_max_num_slots - m_num_used_slots;
+    }
+
+    bool can_swap_out(size_t num_blocks) const {
+        return num_blocks <= get_num_free_slots();
+    }
+
+    bool is_swapped(uint64_t request_id) const {
+        return m_swapped.find(request_id) != m_swapped.end();
+    }
+
+    bool empty() const {
+        return m_swapped.empty();
+    }
+
+    /**
+     * Reserves slots for `num_blocks` blocks of a sequence of the request. The returned buffers are filled by the
+     * caller, in the order of logical blocks.
+     */
+    std::vector<uint8_t*> swap_out(uint64_t request_id, uint64_t sequence_id, size_t num_blocks) {
+        OPENVINO_ASSERT(!is_swapped(request_id), "Request ", request_id, " is already swapped out");
+        OPENVINO_ASSERT(can_swap_out(num_blocks), "Not enough space in the KV cache swap space");
+        SwappedSequence& swapped = m_swapped[request_id];
+        swapped.sequence_id = sequence_id;
+        std::vector<uint8_t*> buffers;
+        buffers.reserve(num_blocks);
+        for (size_t i = 0; i < num_blocks; ++i) {
+            size_t slot = _allocate_slot();
+            swapped.slots.push_back(slot);
+            buffers.push_back(m_slot_buffers[slot].get());
+        }
+        return buffers;
+    }
+
+    const SwappedSequence& get_swapped_sequence(uint64_t request_id) const {
+        auto it = m_swapped.find(request_id);
+        OPENVINO_ASSERT(it != m_swapped.end(), "Request ", request_id, " is not swapped out");
+        return it->second;
+    }
+
+    const uint8_t* get_slot_data(size_t slot) const {
+        OPENVINO_ASSERT(slot < m_slot_buffers.size());
+        return m_slot_buffers[slot].get();
+    }
+
+    /**
+     * Returns the slots of the request to the pool, either after the blocks were copied back into the KV cache or
+     * when the request is dropped.
+     */
+    void release(uint64_t request_id) {
+        auto it = m_swapped.find(request_id);
+        if (it == m_swapped.end()) {
+            return;
+        }
+        for (size_t slot : it->second.slots) {
+            m_free_slots.push_back(slot);
+        }
+        m_num_used_slots -= it->second.slots.size();
+        m_swapped.erase(it);
+    }
+
+    std::vector<uint64_t> get_swapped_request_ids() const {
+        std::vector<uint64_t> request_ids;
+        request_ids.reserve(m_swapped.size());
+        for (const auto& [request_id, swapped] : m_swapped) {
+            request_ids.push_back(request_id);
+        }
+        return request_ids;
+    }
+
+private:
+    size_t m_block_size_in_bytes;
+    size_t m_max_num_slots;
+    size_t m_num_used_slots = 0;
+    std::vector<std::unique_ptr<uint8_t[]>> m_slot_buffers;
+    std::vector<size_t> m_free_slots;
+    std::map<uint64_t, SwappedSequence> m_swapped;
+
+    size_t _allocate_slot() {
+        ++m_num_used_slots;
+        if (!m_free_slots.empty()) {
+            size_t slot = m_free_slots.back();
+            m_free_slots.pop_back();
+            return slot;
+        }
+        m_slot_buffers.push_back(std::make_unique<uint8_t[]>(m_block_size_in_bytes));
+        return m_slot_buffers.size() - 1;
+    }
+};
+
+}  // namespace ov::genai
@@ -9,6 +9,7 @@
 
 #include <openvino/runtime/infer_request.hpp>
 
+#include "openvino/genai/lora_adapter.hpp"
 #include "visual_language/embedding_model.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/scheduler.hpp"
@@ -242,6 +243,11 @@ class ModelRunner {
     ov::Tensor m_cached_token_type_ids;
     ov::Tensor m_cached_deepstack_visual_embeds;
     ov::Tensor m_cached_visual_pos_masks;
+    ov::Tensor m_cached_lora_slot_ids;
+    ov::Tensor m_cached_lora_slot_alphas;
+
+    // set if LoRA adapters are selected per request
+    std::optional<AdapterController> m_adapter_controller;
 public:
     /**
      * Constructs the ModelRunner.
@@ -290,6 +296,26 @@ public:
         return m_request;
     }
 
+    /**
+     * @return Vocabulary size of the "logits" output if it is static in the compiled model, 0 otherwise.
+     */
+    size_t get_vocab_size() {
+        const ov::PartialShape logits_shape = m_request.get_compiled_model().output("logits").get_partial_shape();
+        if (logits_shape.rank().is_dynamic() || logits_shape.rank().get_length() == 0)
+            return 0;
+        const auto& vocab_dim = logits_shape[logits_shape.rank().get_length() - 1];
+        return vocab_dim.is_static() ? vocab_dim.get_length() : 0;
+    }
+
+    /**
+     * Enables filling of per-token LoRA adapter inputs, so that each sequence group is inferred with
+     * adapters from its own GenerationConfig::adapters.
+     * @param adapter_controller Adapter controller created with per-request adapters enabled.
+     */
+    void set_adapter_controller(const AdapterController& adapter_controller) {
+        m_adapter_controller = adapter_controller;
+    }
+
     void enable_hidden_state_export(bool on)   { on ? m_hidden_state_flags |= HS_EXPORT   : m_hidden_state_flags &= ~HS_EXPORT; }
     void enable_hidden_state_import(bool on)   { on ? m_hidden_state_flags |= HS_IMPORT   : m_hidden_state_flags &= ~HS_IMPORT; }
     void enable_hidden_state_internal(bool on) { on ? m_hidden_state_flags |= HS_INTERNAL : m_hidden_state_flags &= ~HS_INTERNAL; }
@@ -336,6 +362,17 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        forward_async(sequence_groups, scheduler_output);
+        return wait_forward(sequence_groups, scheduler_output);
+    }
+
+    /**
+     * Fills the model inputs in the same way as `forward` does, but only starts the inference asynchronously.
+     * Sequence groups and scheduler output must not be modified until a matching `wait_forward` call.
+     * @param sequence_groups A vector of pointers to sequence groups to be processed during this `forward` call
+     * @param scheduler_output The scheduler output struct with information on the specifics of the token scheduling during this forward call
+     */
+    void forward_async(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         m_sequence_hidden_state_mapping.clear();
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
 
@@ -734,13 +771,26 @@ public:
             m_request.set_tensor("score_aggregation_window", score_aggregation_window);
         }
 
-        {
-            static ManualTimer timer("pure generate inference");
-            timer.start();
-            m_request.infer();
-            timer.end();
+        if (m_adapter_controller) {
+            _set_lora_slot_tensors(sequence_groups, scheduler_output, total_num_tokens);
         }
 
+        get_inference_timer().start();
+        m_request.start_async();
+    }
+
+    /**
+     * Waits for the inference started by `forward_async` and collects its outputs.
+     * @param sequence_groups A vector of pointers to sequence groups passed to `forward_async`
+     * @param scheduler_output The scheduler output struct passed to `forward_async`
+     * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
+     */
+    ov::Tensor wait_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        m_request.wait();
+        get_inference_timer().end();
+
+        size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
+
         if (m_collect_attention_scores) {
             _collect_attention_scores(sequence_groups, scheduler_output);
         }
@@ -832,6 +882,12 @@ public:
 private:
     ov::Tensor m_hidden_states;
 
+    // shared by model runners of the thread, accumulates time of model inference
+    static ManualTimer& get_inference_timer() {
+        static thread_local ManualTimer timer("pure generate inference");
+        return timer;
+    }
+
     // Hidden state flags and helpers
     bool _is_hs_export()   const { return m_hidden_state_flags & HS_EXPORT; }
     bool _is_hs_import()   const { return m_hidden_state_flags & HS_IMPORT; }
@@ -962,6 +1018,33 @@ private:
         return cached_tensor;
     }
 
+    // Each scheduled sequence group gets its own slot with alphas of all registered LoRA adapters,
+    // tokens of all its running sequences refer to this slot
+    void _set_lora_slot_tensors(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                const Scheduler::Output& scheduler_output,
+                                size_t total_num_tokens) {
+        size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
+        std::vector<float> alphas;
+        size_t num_adapters = 0;
+        for (size_t i = 0; i < num_sequence_groups; ++i) {
+            size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+            std::vector<float> slot_alphas = m_adapter_controller->get_per_request_alphas(sequence_groups[seq_group_id]->get_sampling_parameters().adapters);
+            num_adapters = slot_alphas.size();
+            alphas.insert(alphas.end(), slot_alphas.begin(), slot_alphas.end());
+        }
+        ov::Tensor slot_alphas = _get_or_resize_tensor(m_cached_lora_slot_alphas, "lora_slot_alphas", {num_sequence_groups, num_adapters}, ov::element::f32);
+        std::copy(alphas.begin(), alphas.end(), slot_alphas.data<float>());
+
+        ov::Tensor slot_ids = _get_or_resize_tensor(m_cached_lora_slot_ids, "lora_slot_ids", {total_num_tokens}, ov::element::i32);
+        int32_t* slot_ids_data = slot_ids.data<int32_t>();
+        for (size_t i = 0; i < num_sequence_groups; ++i) {
+            size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+            SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
+            size_t num_tokens = sequence_group->get_num_scheduled_tokens() * sequence_group->num_running_seqs();
+            slot_ids_data = std::fill_n(slot_ids_data, num_tokens, static_cast<int32_t>(i));
+        }
+    }
+
     // Fills indices for sequences in the order defined by scheduler_output
     void _fill_indices_from_block_tables(
         const std::vector<std::string>& dst_tensor_names,
@@ -85,6 +85,47 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         }
         return results;
     }
+    return _generate_from_prompts(prompts, sampling_params, [&](const std::vector<ov::Tensor>& input_ids) {
+        return generate(input_ids, sampling_params, streamer);
+    });
+}
+
+std::vector<GenerationResult>
+ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
+    const std::vector<std::string>& prompts,
+    std::vector<ov::genai::GenerationConfig> sampling_params,
+    const std::vector<StreamerVariant>& streamers) {
+    OPENVINO_ASSERT(m_model_input_type == ModelInputType::TOKENS, "Per-request streamers are not supported for pipelines with embeddings inputs");
+    return _generate_from_prompts(prompts, sampling_params, [&](const std::vector<ov::Tensor>& input_ids) {
+        return generate(input_ids, sampling_params, streamers);
+    });
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
+    const std::vector<ov::Tensor>& input_ids,
+    const std::vector<GenerationConfig>& sampling_params,
+    const std::vector<StreamerVariant>& streamers) {
+    OPENVINO_ASSERT(streamers.size() == input_ids.size(), "Number of streamers must match the number of prompts");
+    auto has_callback = [](const StreamerVariant& streamer) {
+        if (auto streamer_ptr = std::get_if<std::shared_ptr<StreamerBase>>(&streamer)) {
+            return *streamer_ptr != nullptr;
+        }
+        return !std::holds_alternative<std::monostate>(streamer);
+    };
+    if (std::none_of(streamers.begin(), streamers.end(), has_callback)) {
+        return generate(input_ids, sampling_params, std::monostate{});
+    }
+    OPENVINO_ASSERT(input_ids.size() == 1,
+        "Streaming of several requests is supported only by the continuous batching pipeline without speculative decoding or prompt lookup");
+    return generate(input_ids, sampling_params, streamers[0]);
+}
+
+std::vector<GenerationResult>
+ContinuousBatchingPipeline::IContinuousBatchingPipeline::_generate_from_prompts(
+    const std::vector<std::string>& prompts,
+    const std::vector<ov::genai::GenerationConfig>& sampling_params,
+    const std::function<std::vector<EncodedGenerationResult>(const std::vector<ov::Tensor>&)>& generate_encoded) {
     std::vector<ov::Tensor> input_ids;
     auto start_time = std::chrono::steady_clock::now();
 
@@ -125,7 +166,7 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     }
 
     // TODO Consider moving to method and reuse
-    std::vector<EncodedGenerationResult> encoded = generate(input_ids, sampling_params, streamer);
+    std::vector<EncodedGenerationResult> encoded = generate_encoded(input_ids);
 
     std::vector<GenerationResult> decoded;
     decoded.reserve(encoded.size());
@@ -637,6 +678,44 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(
     return add_request(request_id, inputs, std::move(sampling_params), token_type_ids, prompt_ids, lm_extra_inputs);
 }
 
+void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
+    const std::shared_ptr<ThreadedBatchStreamerWrapper>& streamer_ptr,
+    const std::vector<GenerationHandle>& handles
+) {
+    for (size_t request_idx = 0; request_idx < handles.size(); ++request_idx) {
+        const auto& handle = handles[request_idx];
+        if (!streamer_ptr->has_callback(request_idx)) {
+            continue;
+        }
+
+        const auto streaming_status = streamer_ptr->get_status(request_idx);
+
+        if (streaming_status == StreamingStatus::CANCEL) {
+            handle->cancel();
+            continue;
+        }
+
+        if (streaming_status == StreamingStatus::STOP) {
+            handle->stop();
+            continue;
+        }
+
+        if (!handle->can_read()) {
+            // end the streamer right away instead of waiting for the whole batch
+            if (handle->get_status() != GenerationStatus::RUNNING) {
+                streamer_ptr->end_request(request_idx);
+            }
+            continue;
+        }
+
+        std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read();
+        OPENVINO_ASSERT(generation_outputs.size() <= 1);
+        if (!generation_outputs.empty()) {
+            streamer_ptr->write(request_idx, generation_outputs.begin()->second.generated_ids);
+        }
+    }
+}
+
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
     const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr,
     const GenerationHandle& handle
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "visual_language/inputs_embedder.hpp"
 #include "visual_language/vision_registry.hpp"
@@ -71,6 +73,16 @@ protected:
     std::shared_ptr<VisionRegistry> m_vision_registry;
 
     void stream_tokens(const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr, const GenerationHandle& handle);
+    // streams the outputs of `handles`, the i-th handle to the i-th streamer
+    void stream_tokens(const std::shared_ptr<ThreadedBatchStreamerWrapper>& streamer_ptr, const std::vector<GenerationHandle>& handles);
+
+    /**
+     * Tokenizes prompts (applying chat template and chat history), runs `generate_encoded` over them and decodes results
+     */
+    std::vector<GenerationResult>
+    _generate_from_prompts(const std::vector<std::string>& prompts,
+                           const std::vector<GenerationConfig>& sampling_params,
+                           const std::function<std::vector<EncodedGenerationResult>(const std::vector<ov::Tensor>&)>& generate_encoded);
 public:
     GenerationConfig get_config() const;
     void set_config(const GenerationConfig& config);
@@ -136,6 +148,16 @@ public:
              const std::optional<std::vector<ov::Tensor>>& prompt_ids = std::nullopt,
              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list = std::nullopt) = 0;
 
+    /**
+     * Performs monolitic generation based on encoded prompts, streaming each request to its own streamer
+     * (std::monostate for requests which are not streamed). Pipelines which can't stream several requests
+     * at once support a single prompt only.
+     */
+    virtual std::vector<EncodedGenerationResult>
+    generate(const std::vector<ov::Tensor>& input_ids,
+             const std::vector<GenerationConfig>& sampling_params,
+             const std::vector<StreamerVariant>& streamers);
+
     /**
      * Performs monolitic generation based on text prompts
      */
@@ -144,6 +166,11 @@ public:
              std::vector<GenerationConfig> sampling_params,
              const StreamerVariant& streamer);
 
+    std::vector<GenerationResult>
+    generate(const std::vector<std::string>& prompts,
+             std::vector<GenerationConfig> sampling_params,
+             const std::vector<StreamerVariant>& streamers);
+
     virtual std::vector<VLMDecodedResults>
     generate(
              const std::vector<std::string>& prompts,
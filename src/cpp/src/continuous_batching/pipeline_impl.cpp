@@ -130,9 +130,18 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     m_device = device;
     // apply LoRA
     auto filtered_properties = extract_adapters_from_properties(properties, &m_generation_config.adapters);
+    // Extract per_request_adapters property if exists and remove it from properties
+    auto per_request_adapters_it = filtered_properties->find("per_request_adapters");
+    if (per_request_adapters_it != filtered_properties->end()) {
+        m_is_per_request_adapters_enabled = per_request_adapters_it->second.as<bool>();
+        OPENVINO_ASSERT(!m_is_per_request_adapters_enabled || m_generation_config.adapters.has_value(),
+            "'per_request_adapters' property requires LoRA adapters to be passed to the pipeline constructor");
+        filtered_properties.fork().erase("per_request_adapters");
+    }
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
-        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        // TODO: Make the prefix name configurable
+        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device, m_is_per_request_adapters_enabled);
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
@@ -141,6 +150,19 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract batched_sampling property if exists and remove it from properties
+    bool is_batched_sampling = false;
+    auto batched_sampling_it = filtered_properties->find("batched_sampling");
+    if (batched_sampling_it != filtered_properties->end()) {
+        is_batched_sampling = batched_sampling_it->second.as<bool>();
+        filtered_properties.fork().erase("batched_sampling");
+    }
+    // Extract pipelined_step property if exists and remove it from properties
+    auto pipelined_step_it = filtered_properties->find("pipelined_step");
+    if (pipelined_step_it != filtered_properties->end()) {
+        m_is_pipelined_step_enabled = pipelined_step_it->second.as<bool>();
+        filtered_properties.fork().erase("pipelined_step");
+    }
 
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
     std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
@@ -159,6 +181,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request);
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
     m_block_size = cache_manager->get_block_size();
+    if (!scheduler_config.prefix_cache_spill_path.empty()) {
+        // spilled blocks outlive the pipeline, so both their hashes and the spill file are bound to the model weights
+        m_model_fingerprint = utils::get_model_fingerprint(model);
+        cache_manager->set_model_fingerprint(m_model_fingerprint);
+    }
 
 
     // Scheduler configuration
@@ -177,6 +204,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     if (normalized_config.num_kv_blocks > 0) {
         size_t size_in_bytes = cache_manager->get_block_size_in_bytes() * normalized_config.num_kv_blocks;
         OPENVINO_ASSERT(size_in_bytes <= total_mem_size, "Requested number of KV-blocks require more memory than available on the system.");
+    } else if (total_mem_size != std::numeric_limits<size_t>::max()) {
+        // KV cache grows on demand up to the system memory size; reserve address space for all of it,
+        // so that growing doesn't reallocate and copy the cache (host memory only)
+        cache_manager->reserve_host_cache(total_mem_size / cache_manager->get_block_size_in_bytes());
     }
 
     bool can_use_partial_preemption = true;
@@ -219,7 +250,17 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
                                                        /* is_use_adaptive_rkv = */ false);
     }
 
+    if (m_is_per_request_adapters_enabled) {
+        // LoRA tensors of all registered adapters are set once, requests select them via per-token model inputs
+        m_adapter_controller->apply(infer_request);
+        m_model_runner->set_adapter_controller(*m_adapter_controller);
+    }
+
     m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads);
+    m_sampler->set_batched_sampling(is_batched_sampling);
+    if (m_is_pipelined_step_enabled) {
+        m_vocab_size = m_model_runner->get_vocab_size();
+    }
     m_sampler->set_seed(m_generation_config.rng_seed);
 
     // If eos_token_id was not provided, take value
@@ -306,6 +347,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
                                                          token_type_ids);
     }
 
+    sequence_group->set_hash_seed(m_model_fingerprint);
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
@@ -345,7 +387,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_reques
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
-    static ManualTimer step_timer("step()");
+    static thread_local ManualTimer step_timer("step()");
     step_timer.start();
 
     _pull_awaiting_requests();
@@ -353,13 +395,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     Scheduler::Output scheduler_output;
 
     {
-        static ManualTimer scheduling_timer("scheduling");
+        static thread_local ManualTimer scheduling_timer("scheduling");
         scheduling_timer.start();
         scheduler_output = m_scheduler->schedule(m_requests);
         scheduling_timer.end();
 
         m_pipeline_metrics.kv_cache_size_in_bytes = scheduler_output.m_cache_size_in_bytes;
         m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
+        m_pipeline_metrics.scheduled_tokens = scheduler_output.m_total_num_scheduled_tokens;
+        m_pipeline_metrics.preempted_requests = scheduler_output.m_num_preempted_sequence_groups;
         m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
@@ -391,10 +435,26 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     ov::Tensor logits;
 
     {
-        static ManualTimer timer("forward");
+        static thread_local ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
-        logits = m_model_runner->forward(m_requests, scheduler_output);
+        if (m_is_pipelined_step_enabled) {
+            m_model_runner->forward_async(m_requests, scheduler_output);
+            // while the device is busy, stream tokens of the previous step
+            if (m_stream_previous_step)
+                m_stream_previous_step();
+            // and do the part of the sampling which does not depend on logits
+            // (logit processors, structured output matchers and stop strings for newly scheduled requests)
+            if (m_vocab_size > 0) {
+                static thread_local ManualTimer prepare_timer("sampler preparation");
+                prepare_timer.start();
+                m_sampler->prepare(m_requests, m_vocab_size);
+                prepare_timer.end();
+            }
+            logits = m_model_runner->wait_forward(m_requests, scheduler_output);
+        } else {
+            logits = m_model_runner->forward(m_requests, scheduler_output);
+        }
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
         timer.end();
@@ -422,7 +482,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     SamplerOutput sampler_output;
     {
-        static ManualTimer timer("sample");
+        static thread_local ManualTimer timer("sample");
         timer.start();
         sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
         m_batch_size = sampler_output.num_generated_tokens;
@@ -431,7 +491,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
-        static ManualTimer free_fork_timer("fork / free sequence");
+        static thread_local ManualTimer free_fork_timer("fork / free sequence");
         free_fork_timer.start();
 
         for (const auto& pair : sampler_output.m_forked_sequences) {
@@ -448,7 +508,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     }
 
     {
-        static ManualTimer candidates_timer("generate_candidates_for_prompt_lookup()");
+        static thread_local ManualTimer candidates_timer("generate_candidates_for_prompt_lookup()");
         candidates_timer.start();
         generate_candidates_for_prompt_lookup();
         candidates_timer.end();
@@ -460,7 +520,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     // notify requests dropped by handle
     {
-        static ManualTimer report_tokens_timer("notify requests dropped by handle");
+        static thread_local ManualTimer report_tokens_timer("notify requests dropped by handle");
         report_tokens_timer.start();
         _notify_requests_dropped_by_handle();
         report_tokens_timer.end();
@@ -469,7 +529,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     // free non running requests for current step
 
     {
-        static ManualTimer clean_up_requests_timer("free non running requests");
+        static thread_local ManualTimer clean_up_requests_timer("free non running requests");
         clean_up_requests_timer.start();
         _free_non_running_requests();
         clean_up_requests_timer.end();
@@ -492,6 +552,43 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
                                                              const std::optional<std::vector<std::pair<ov::Tensor, std::optional<int64_t>>>>& position_ids_list,
                                                              const std::optional<std::vector<ov::Tensor>>& prompt_ids,
                                                              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list) {
+    // a single streamer serves the only request
+    std::vector<StreamerVariant> streamers(input_ids.size(), std::monostate{});
+    if (!streamers.empty()) {
+        streamers[0] = streamer;
+    }
+    const auto streamer_ptr = std::make_shared<ThreadedBatchStreamerWrapper>(streamers, m_tokenizer);
+
+    OPENVINO_ASSERT(!streamer_ptr->has_callbacks() || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
+        (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
+        "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding. "
+        "Pass a streamer per request to stream a batch");
+
+    return _generate(input_ids, sampling_params, streamer_ptr, token_type_ids, position_ids_list, prompt_ids, lm_extra_inputs_list);
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
+                                                             const std::vector<GenerationConfig>& sampling_params,
+                                                             const std::vector<StreamerVariant>& streamers) {
+    OPENVINO_ASSERT(streamers.size() == input_ids.size(), "Number of streamers must match the number of prompts");
+    const auto streamer_ptr = std::make_shared<ThreadedBatchStreamerWrapper>(streamers, m_tokenizer);
+    for (size_t request_id = 0; request_id < sampling_params.size(); ++request_id) {
+        OPENVINO_ASSERT(!streamer_ptr->has_callback(request_id) || sampling_params[request_id].num_return_sequences == 1 &&
+            (sampling_params[request_id].is_greedy_decoding() || sampling_params[request_id].is_multinomial()),
+            "Currently streaming is possible only for greedy or multinomial decoding with a single return sequence, request ", request_id);
+    }
+    return _generate(input_ids, sampling_params, streamer_ptr);
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_generate(const std::vector<ov::Tensor>& input_ids,
+                                                              const std::vector<GenerationConfig>& sampling_params,
+                                                              const std::shared_ptr<ThreadedBatchStreamerWrapper>& streamer_ptr,
+                                                              const std::optional<std::vector<ov::Tensor>>& token_type_ids,
+                                                              const std::optional<std::vector<std::pair<ov::Tensor, std::optional<int64_t>>>>& position_ids_list,
+                                                              const std::optional<std::vector<ov::Tensor>>& prompt_ids,
+                                                              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list) {
 
     _reset_cache_usage_statistics();
     ManualTimer generate_timer("generate()");
@@ -512,18 +609,14 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    if (!m_is_per_request_adapters_enabled) {
+        // checks that all requests has the same LoRA adapters property value
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests, unless 'per_request_adapters' property is enabled");
+        }
+        set_adapters(sampling_params[0].adapters);
     }
-    set_adapters(sampling_params[0].adapters);
-
-    const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
-
-    OPENVINO_ASSERT(!streamer_ptr->has_callback() || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
-        (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
-        "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
 
     std::vector<GenerationHandle> generations;
     for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
@@ -553,10 +646,15 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
 
     auto all_requests = get_awaiting_requests(); // we need to store all requests to get results from them once generation has finished
 
-    GenerationHandle& generation = generations.at(0);
-
     streamer_ptr->start();
     m_sampler->clear_structured_output_compile_times();
+    // in pipelined mode tokens of each step are streamed during inference of the next step
+    m_is_streaming_deferred = m_is_pipelined_step_enabled;
+    if (m_is_streaming_deferred) {
+        m_stream_previous_step = [&] () {
+            stream_tokens(streamer_ptr, generations);
+        };
+    }
     while (has_non_finished_requests()) {
         try {
             const auto infer_start = std::chrono::steady_clock::now();
@@ -573,11 +671,20 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
                 raw_perf_counters.m_batch_sizes.emplace_back(m_batch_size);
             }
         } catch (...) {
+            m_is_streaming_deferred = false;
+            m_stream_previous_step = nullptr;
             drop_requests(); // remove all requests from pipeline state in case of exception
             streamer_ptr->end();
             std::rethrow_exception(std::current_exception());
         }
-        stream_tokens(streamer_ptr, generation);
+        if (!m_is_streaming_deferred)
+            stream_tokens(streamer_ptr, generations);
+    }
+    if (m_is_streaming_deferred) {
+        m_is_streaming_deferred = false;
+        m_stream_previous_step = nullptr;
+        // stream tokens of the last step
+        stream_tokens(streamer_ptr, generations);
     }
 
     auto times = m_sampler->get_structured_output_times();
@@ -642,16 +749,16 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_requests() {
+    _detach_non_running_requests();
+    _free_detached_requests();
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_detach_non_running_requests() {
     std::vector<SequenceGroup::Ptr>::iterator requests_iterator = m_requests.begin();
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
-            for (const auto& sequence: request->get_sequences()) {
-                if (m_scheduler->has_block_table(sequence->get_id())) {
-                    m_scheduler->free_sequence(sequence->get_id());
-                }
-            }
-            m_sampler->clear_request_info(request->get_request_id());
+            m_requests_to_free.push_back(request);
             requests_iterator = m_requests.erase(requests_iterator);
         } else {
             requests_iterator++;
@@ -659,6 +766,18 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_detached_requests() {
+    for (const auto& request : m_requests_to_free) {
+        for (const auto& sequence: request->get_sequences()) {
+            if (m_scheduler->has_block_table(sequence->get_id())) {
+                m_scheduler->free_sequence(sequence->get_id());
+            }
+        }
+        m_sampler->clear_request_info(request->get_request_id());
+    }
+    m_requests_to_free.clear();
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_notify_requests_dropped_by_handle() {
     // Notify the last time by pushing empty output
     // This causes read() to unblock by adding anything to the queue
@@ -687,15 +806,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_reset_cache_usage_stat
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests() {
-    for (const std::shared_ptr<ov::genai::SequenceGroup> request : m_requests) {
-        for (const auto& sequence: request->get_sequences()) {
-            if (m_scheduler->has_block_table(sequence->get_id())) {
-                m_scheduler->free_sequence(sequence->get_id());
-            }
-        }
-        m_sampler->clear_request_info(request->get_request_id());
-    }
+    m_requests_to_free.insert(m_requests_to_free.end(), m_requests.begin(), m_requests.end());
     m_requests.clear();
+    _free_detached_requests();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups,
@@ -37,8 +37,24 @@ protected:
     // flag to enable validation mode for sampler
     bool m_is_validation_mode_enabled = false;
 
+    // flag to select LoRA adapters individually for each request ("per_request_adapters" property)
+    bool m_is_per_request_adapters_enabled = false;
+
+    // flag to overlap logits-independent CPU work of the step with model inference ("pipelined_step" property)
+    bool m_is_pipelined_step_enabled = false;
+    // flag to postpone streaming of the step till inference of the next step, set by generate() in pipelined mode
+    bool m_is_streaming_deferred = false;
+    // streams tokens of the previous step while inference of the current step is running
+    std::function<void()> m_stream_previous_step;
+    // requests detached from m_requests whose KV cache blocks and sampler state are not released yet
+    std::vector<SequenceGroup::Ptr> m_requests_to_free;
+    // static vocabulary size of the model or 0 if it is not known before inference
+    size_t m_vocab_size = 0;
+
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
+    // identity of the model used as seed of KV block hashes when prefix cache blocks are persisted, 0 otherwise
+    uint64_t m_model_fingerprint = 0;
 
     // Pre-allocated per-layer storages for the per-token cache re-rotation deltas used in cache eviction case
     std::vector<ov::Tensor> m_rotation_deltas_stores;
@@ -75,6 +91,16 @@ protected:
      */
     void _free_non_running_requests();
 
+    /**
+     * Moves non-running (finished, dropped or OOM) requests from running queue to the list of requests to be freed
+     */
+    void _detach_non_running_requests();
+
+    /**
+     * Releases KV cache blocks and sampler state of detached requests
+     */
+    void _free_detached_requests();
+
     /**
      * Notify dropped requests by pushing empty output
      */
@@ -100,6 +126,15 @@ protected:
 
     virtual void drop_requests();
 
+    std::vector<EncodedGenerationResult>
+    _generate(const std::vector<ov::Tensor>& input_ids,
+              const std::vector<GenerationConfig>& sampling_params,
+              const std::shared_ptr<ThreadedBatchStreamerWrapper>& streamer_ptr,
+              const std::optional<std::vector<ov::Tensor>>& token_type_ids = std::nullopt,
+              const std::optional<std::vector<std::pair<ov::Tensor, std::optional<int64_t>>>>& position_ids_list = std::nullopt,
+              const std::optional<std::vector<ov::Tensor>>& prompt_ids = std::nullopt,
+              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list = std::nullopt);
+
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
                            const Tokenizer& tokenizer,
@@ -151,6 +186,14 @@ public:
              const std::optional<std::vector<ov::Tensor>>& prompt_ids = std::nullopt,
              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list = std::nullopt) override;
 
+    /**
+     * Generates a batch streaming each request to its own streamer; all streamers are driven by one background thread
+     */
+    std::vector<EncodedGenerationResult>
+    generate(const std::vector<ov::Tensor>& input_ids,
+             const std::vector<GenerationConfig>& sampling_params,
+             const std::vector<StreamerVariant>& streamers) override;
+
     /**
      * Updates LoRA adapters for current generation call
      */
@@ -0,0 +1,161 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief A range of virtual address space reserved up front, whose pages are committed on demand.
+ *
+ * Reserving takes no physical memory. Committing a larger prefix of the range keeps the address and contents of the
+ * already committed part, so a buffer placed at the beginning of the range grows in place without reallocation and
+ * copying; only the new pages are backed by physical memory when first touched.
+ */
+class ReservedHostMemory {
+public:
+    explicit ReservedHostMemory(size_t capacity_in_bytes) :
+            m_page_size(_get_page_size()),
+            m_capacity(_round_up(capacity_in_bytes, m_page_size)) {
+        OPENVINO_ASSERT(m_capacity > 0, "Reserved memory capacity must be non-zero");
+#ifdef _WIN32
+        m_data = static_cast<uint8_t*>(VirtualAlloc(nullptr, m_capacity, MEM_RESERVE, PAGE_NOACCESS));
+        if (m_data == nullptr) {
+            throw std::bad_alloc();
+        }
+#else
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+        flags |= MAP_NORESERVE;
+#endif
+        void* data = mmap(nullptr, m_capacity, PROT_NONE, flags, -1, 0);
+        if (data == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        m_data = static_cast<uint8_t*>(data);
+#endif
+    }
+
+    ReservedHostMemory(const ReservedHostMemory&) = delete;
+    ReservedHostMemory& operator=(const ReservedHostMemory&) = delete;
+
+    ~ReservedHostMemory() {
+#ifdef _WIN32
+        VirtualFree(m_data, 0, MEM_RELEASE);
+#else
+        munmap(m_data, m_capacity);
+#endif
+    }
+
+    uint8_t* data() const {
+        return m_data;
+    }
+
+    size_t get_capacity() const {
+        return m_capacity;
+    }
+
+    size_t get_committed_size() const {
+        return m_committed_size;
+    }
+
+    /**
+     * Makes the first `size_in_bytes` bytes of the range accessible. Already committed pages are kept as is.
+     * @throws std::bad_alloc if the size exceeds the capacity or the system can't commit more memory.
+     */
+    void commit(size_t size_in_bytes) {
+        if (size_in_bytes <= m_committed_size) {
+            return;
+        }
+        if (size_in_bytes > m_capacity) {
+            throw std::bad_alloc();
+        }
+        const size_t new_committed_size = _round_up(size_in_bytes, m_page_size);
+#ifdef _WIN32
+        if (VirtualAlloc(m_data + m_committed_size, new_committed_size - m_committed_size, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+            throw std::bad_alloc();
+        }
+#else
+        if (mprotect(m_data + m_committed_size, new_committed_size - m_committed_size, PROT_READ | PROT_WRITE) != 0) {
+            throw std::bad_alloc();
+        }
+#endif
+        m_committed_size = new_committed_size;
+    }
+
+    /**
+     * Returns the committed pages to the system, keeping the reservation. The contents are lost.
+     */
+    void decommit() {
+        if (m_committed_size == 0) {
+            return;
+        }
+#ifdef _WIN32
+        VirtualFree(m_data, m_committed_size, MEM_DECOMMIT);
+#else
+        madvise(m_data, m_committed_size, MADV_DONTNEED);
+        mprotect(m_data, m_committed_size, PROT_NONE);
+#endif
+        m_committed_size = 0;
+    }
+
+private:
+    size_t m_page_size;
+    size_t m_capacity;
+    size_t m_committed_size = 0;
+    uint8_t* m_data = nullptr;
+
+    static size_t _get_page_size() {
+#ifdef _WIN32
+        SYSTEM_INFO system_info;
+        GetSystemInfo(&system_info);
+        return system_info.dwPageSize;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    static size_t _round_up(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+};
+
+/**
+ * @brief Allocator for ov::Tensor which places the tensor at the beginning of a ReservedHostMemory, committing as
+ * much as needed. Tensors created with it keep the memory alive; deallocation is a no-op, so a larger tensor can
+ * replace a smaller one over the same memory while keeping its contents.
+ */
+struct ReservedHostMemoryAllocator {
+    std::shared_ptr<ReservedHostMemory> memory;
+
+    void* allocate(size_t bytes, size_t alignment) {
+        OPENVINO_ASSERT(reinterpret_cast<uintptr_t>(memory->data()) % alignment == 0, "Unsupported alignment ", alignment);
+        memory->commit(bytes);
+        return memory->data();
+    }
+
+    void deallocate(void*, size_t, size_t) noexcept {}
+
+    bool is_equal(const ReservedHostMemoryAllocator& other) const {
+        return memory == other.memory;
+    }
+};
+
+}  // namespace ov::genai
@@ -12,6 +12,8 @@
 #include "continuous_batching/block_manager.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/kv_swap_space.hpp"
+#include "continuous_batching/slo_tracker.hpp"
 #include "continuous_batching/timer.hpp"
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
@@ -32,8 +34,19 @@ class Scheduler {
     const float m_cache_growth_num_tokens = 256; // Number of tokens by which KV-cache is increased
 
     std::shared_ptr<CacheManager> m_cache_manager;
+    // second-tier prefix cache, set only if `prefix_cache_spill_path` is configured
+    std::shared_ptr<KVCacheSpillStore> m_spill_store;
+    // host memory pool for sequence groups preempted by swapping, set only for PreemptionMode::SWAP and host KV cache
+    std::shared_ptr<KVCacheSwapSpace> m_swap_space;
 
     size_t m_snapkv_window_size = 1;
+    // number of sequence groups preempted during the current schedule() call
+    size_t m_num_preempted_sequence_groups = 0;
+
+    // progress of requests against their TTFT / TPOT targets
+    SLOTracker m_slo_tracker;
+    // new requests of lower priority classes are not admitted, while requests of a higher class miss their targets
+    size_t m_min_admitted_priority = 0;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -67,6 +80,8 @@ public:
         float m_cache_usage = 0.0;
         // cache usage size in bytes
         size_t m_cache_size_in_bytes = 0;
+        // number of sequence groups preempted to free KV cache blocks
+        size_t m_num_preempted_sequence_groups = 0;
     };
 
     Scheduler(size_t block_size, std::shared_ptr<CacheManager> cache_manager, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true, size_t snapkv_window_size = 1) :
@@ -76,17 +91,39 @@ public:
         m_snapkv_window_size(snapkv_window_size) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        if (!m_config.prefix_cache_spill_path.empty()) {
+            _initialize_spill_store();
+        }
+        if (m_config.preemption_mode == PreemptionMode::SWAP && m_cache_manager->is_host_cache()) {
+            // block contents can be transferred only for KV cache allocated in host memory, otherwise recompute is used
+            size_t max_size_in_bytes = m_config.swap_space_size * 1024 * 1024 * 1024; // convert GBs to bytes
+            m_swap_space = std::make_shared<KVCacheSwapSpace>(max_size_in_bytes, m_cache_manager->get_block_contents_size_in_bytes());
+        }
     }
 
     void release() {
+        if (m_spill_store && m_block_manager && m_cache_manager) {
+            // persist blocks which are still only in memory
+            m_block_manager->spill_cached_blocks();
+            _execute_spill_transfers();
+            m_spill_store->wait_for_writes();
+        }
+        m_spill_store.reset();
+        m_swap_space.reset();
         m_cache_manager.reset();
         m_block_manager.reset();
     }
 
     Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
         Output scheduler_output;
+        m_num_preempted_sequence_groups = 0;
         // map of src -> dst blocks copies, which need to be performed by CacheManager
         std::map<size_t, std::list<size_t>> block_copy_map;
+        // number of tokens written to partially filled src blocks, the rest of them is not copied
+        std::map<size_t, size_t> block_num_filled_tokens;
+
+        // indices in the output refer to the reordered vector
+        _order_by_priority(sequence_groups);
 
         // free some blocks taken by non-confirmed candidates in SD / prompt look-up
         clean_empty_blocks(sequence_groups);
@@ -95,10 +132,15 @@ public:
             _initialize_cache(sequence_groups);
         }
 
+        if (m_swap_space && !m_swap_space->empty()) {
+            // swapped out groups are resumed before new work is scheduled, in order of their priority
+            _swap_in_sequence_groups(sequence_groups);
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
-            _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+            _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map, block_num_filled_tokens);
             // some tokens from generation prompt are also scheduled
             _schedule_prompt_phase_dynamic_split_fuse(sequence_groups, scheduler_output);
         } else {
@@ -109,18 +151,23 @@ public:
 
             if (!scheduler_output.is_prompt) {
                 // prompt sequences are not scheduler => scheduler generation phase by dynamic_split_fuse implementation
-                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map, block_num_filled_tokens);
             }
         }
 
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+        if (m_spill_store) {
+            // must happen before block copies and inference overwrite contents of the evicted blocks
+            _execute_spill_transfers();
+        }
         _clear_waiting_sequences(sequence_groups);
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
         scheduler_output.m_cache_size_in_bytes = m_block_manager->get_total_number_of_kv_blocks() * m_cache_manager->get_block_size_in_bytes();
+        scheduler_output.m_num_preempted_sequence_groups = m_num_preempted_sequence_groups;
 
-        static ManualTimer copy_blocks_timer("copy block");
+        static thread_local ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
-        m_cache_manager->copy_blocks(block_copy_map);
+        m_cache_manager->copy_blocks(block_copy_map, block_num_filled_tokens);
         copy_blocks_timer.end();
 
         return scheduler_output;
@@ -131,8 +178,10 @@ public:
      * when candidates are not confirmed by main model and we need to free blocks, taken by these candidates
      */
     void clean_empty_blocks(std::vector<SequenceGroup::Ptr>& seq_groups) {
-        for (const auto& seq_group : seq_groups)
-            m_block_manager->free_empty_physical_blocks(seq_group);
+        for (const auto& seq_group : seq_groups) {
+            if (!_is_swapped(seq_group))
+                m_block_manager->free_empty_physical_blocks(seq_group);
+        }
     }
 
     const std::vector<BlocksPerLayer>& get_block_tables(const Sequence& seq) const {
@@ -178,6 +227,225 @@ public:
     }
 
 private:
+    void _initialize_spill_store() {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "prefix_cache_spill_path requires enable_prefix_caching to be turned on");
+        OPENVINO_ASSERT(m_config.prefix_cache_spill_size > 0, "prefix_cache_spill_size must be non-zero");
+        // blocks are restored when a request is added, which requires KV cache blocks to exist at that moment
+        OPENVINO_ASSERT(m_config.num_kv_blocks > 0, "prefix_cache_spill_path requires KV cache size to be set with num_kv_blocks or cache_size");
+        OPENVINO_ASSERT(m_cache_manager->is_host_cache(), "Spilling of prefix cache is supported only for KV cache allocated in host memory (CPU)");
+        size_t max_size_in_bytes = m_config.prefix_cache_spill_size * 1024 * 1024 * 1024; // convert GBs to bytes
+        m_spill_store = std::make_shared<KVCacheSpillStore>(m_config.prefix_cache_spill_path,
+                                                            max_size_in_bytes,
+                                                            m_cache_manager->get_block_contents_size_in_bytes(),
+                                                            m_cache_manager->get_layout_fingerprint());
+        m_block_manager->set_spill_store(m_spill_store);
+    }
+
+    void _execute_spill_transfers() {
+        static thread_local ManualTimer spill_timer("spill KV blocks");
+        spill_timer.start();
+        for (auto& transfer : m_spill_store->take_pending_transfers()) {
+            if (transfer.direction == KVCacheSpillTransfer::Direction::SPILL) {
+                // only the copy out of the KV cache happens here, the disk write is done by the store in background
+                std::vector<uint8_t> buffer = m_spill_store->acquire_buffer();
+                m_cache_manager->export_block(transfer.block_indices, buffer.data());
+                m_spill_store->write_async(transfer.hash, std::move(buffer));
+            } else {
+                m_cache_manager->import_block(transfer.block_indices, transfer.data.data());
+                m_spill_store->release_buffer(std::move(transfer.data));
+            }
+        }
+        spill_timer.end();
+    }
+
+    bool _is_swapped(const SequenceGroup::CPtr& sequence_group) const {
+        return m_swap_space && m_swap_space->is_swapped(sequence_group->get_request_id());
+    }
+
+    static std::vector<size_t> _get_block_indices(const std::vector<BlocksPerLayer>& block_tables, size_t logical_block_idx) {
+        std::vector<size_t> block_indices;
+        block_indices.reserve(block_tables.size());
+        for (const auto& blocks : block_tables) {
+            block_indices.push_back(blocks[logical_block_idx]->get_index());
+        }
+        return block_indices;
+    }
+
+    /**
+     * Whether the sequence group is long enough for swapping to be cheaper than recompute and can be swapped out.
+     * Groups with several sequences are always recomputed, since blocks shared between their sequences would
+     * be swapped in as separate copies.
+     */
+    bool _can_preempt_by_swap(const SequenceGroup::Ptr& sequence_group) {
+        if (!m_swap_space || sequence_group->get_num_processed_tokens() < m_config.swap_min_num_tokens) {
+            return false;
+        }
+        auto sequences = sequence_group->get_not_finished_sequences();
+        if (sequences.size() != 1 || !m_block_manager->has_block_table(sequences[0]->get_id())) {
+            return false;
+        }
+        return m_swap_space->can_swap_out(m_block_manager->get_block_tables(sequences[0]->get_id())[0].size());
+    }
+
+    bool _preempt_by_swap(SequenceGroup::Ptr sequence_group) {
+        static thread_local ManualTimer swap_out_timer("swap out KV blocks");
+        swap_out_timer.start();
+        size_t prev_blocks_count = m_block_manager->num_free_blocks();
+        uint64_t seq_id = sequence_group->get_not_finished_sequences()[0]->get_id();
+        const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+        const size_t num_blocks = block_tables[0].size();
+        auto buffers = m_swap_space->swap_out(sequence_group->get_request_id(), seq_id, num_blocks);
+        for (size_t i = 0; i < num_blocks; ++i) {
+            m_cache_manager->export_block(_get_block_indices(block_tables, i), buffers[i]);
+        }
+        // processed tokens are kept, the group stays out of scheduling until its blocks are swapped in
+        m_block_manager->free_sequence(seq_id);
+        swap_out_timer.end();
+        return m_block_manager->num_free_blocks() > prev_blocks_count;
+    }
+
+    void _swap_in_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // release blocks of requests which were finished or dropped while swapped out
+        for (uint64_t request_id : m_swap_space->get_swapped_request_ids()) {
+            const uint64_t seq_id = m_swap_space->get_swapped_sequence(request_id).sequence_id;
+            bool is_alive = std::any_of(sequence_groups.begin(), sequence_groups.end(), [&](const SequenceGroup::Ptr& sequence_group) {
+                if (sequence_group->get_request_id() != request_id || sequence_group->has_finished() ||
+                    sequence_group->handle_stopped() || sequence_group->handle_cancelled()) {
+                    return false;
+                }
+                auto sequences = sequence_group->get_not_finished_sequences();
+                return sequences.size() == 1 && sequences[0]->get_id() == seq_id;
+            });
+            if (!is_alive) {
+                m_swap_space->release(request_id);
+            }
+        }
+
+        static thread_local ManualTimer swap_in_timer("swap in KV blocks");
+        swap_in_timer.start();
+        // blocks which running groups need to generate their next tokens, a resumed group must not take them,
+        // otherwise it would cause a preemption right away and be swapped out again
+        size_t num_reserved_blocks = 0;
+        for (const auto& sequence_group : sequence_groups) {
+            if (!_is_swapped(sequence_group) && _is_generating(sequence_group)) {
+                num_reserved_blocks += _get_num_blocks_for_next_token(sequence_group);
+            }
+        }
+        for (const auto& sequence_group : sequence_groups) {
+            if (!_is_swapped(sequence_group)) {
+                continue;
+            }
+            const auto& swapped = m_swap_space->get_swapped_sequence(sequence_group->get_request_id());
+            const size_t num_blocks = swapped.slots.size();
+            while (!m_block_manager->can_allocate_blocks(num_blocks + num_reserved_blocks)) {
+                if (!_try_increase_cache()) {
+                    break;
+                }
+            }
+            if (!m_block_manager->can_allocate_blocks(num_blocks + num_reserved_blocks)) {
+                // keep the priority order: lower priority groups are not resumed before this one
+                break;
+            }
+            Sequence::Ptr sequence = sequence_group->get_not_finished_sequences()[0];
+            size_t num_restored_blocks = 0;
+            if (m_config.enable_prefix_caching && sequence_group->get_num_evicted_tokens() == 0) {
+                // fully filled blocks can still be in the prefix cache, only the rest is imported from the swap space
+                const size_t num_full_blocks = std::min(num_blocks, sequence_group->get_num_processed_tokens() / m_block_manager->get_block_size());
+                num_restored_blocks = m_block_manager->restore_cached_blocks(sequence, num_full_blocks);
+            }
+            if (num_restored_blocks < num_blocks) {
+                m_block_manager->allocate(sequence, num_blocks - num_restored_blocks, sequence_group->get_prompt_len());
+            }
+            m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+            if (m_spill_store) {
+                // allocated blocks could be taken from the prefix cache, their contents are spilled before being overwritten
+                _execute_spill_transfers();
+            }
+            const auto& block_tables = m_block_manager->get_block_tables(sequence->get_id());
+            for (size_t i = num_restored_blocks; i < num_blocks; ++i) {
+                m_cache_manager->import_block(_get_block_indices(block_tables, i), m_swap_space->get_slot_data(swapped.slots[i]));
+            }
+            m_swap_space->release(sequence_group->get_request_id());
+            num_reserved_blocks += _get_num_blocks_for_next_token(sequence_group);
+        }
+        swap_in_timer.end();
+    }
+
+    bool _is_generating(const SequenceGroup::Ptr& sequence_group) const {
+        return sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->has_finished() &&
+               !sequence_group->handle_stopped() && !sequence_group->handle_cancelled();
+    }
+
+    // number of new blocks required by a running group to process its next token (and tokens to validate, if any)
+    size_t _get_num_blocks_for_next_token(const SequenceGroup::CPtr& sequence_group) const {
+        const size_t block_size = m_block_manager->get_block_size();
+        const size_t context_len = sequence_group->get_num_processed_tokens() + sequence_group->get_num_available_tokens_for_batching();
+        const size_t num_logical_blocks = (context_len - sequence_group->get_num_evicted_tokens() + block_size - 1) / block_size;
+        return m_block_manager->required_blocks_count(sequence_group, num_logical_blocks);
+    }
+
+    static size_t _get_num_generated_tokens(const SequenceGroup::CPtr& sequence_group) {
+        size_t num_generated_tokens = 0;
+        for (const auto& sequence : sequence_group->get_sequences()) {
+            num_generated_tokens = std::max(num_generated_tokens, sequence->get_generated_len());
+        }
+        return num_generated_tokens;
+    }
+
+    /**
+     * Sorts sequence groups by priority class (highest first) and, within a class, by the time left until the
+     * groups miss their TTFT / TPOT targets (least first). Groups without priorities and targets keep their
+     * insertion order. Since the scheduler serves groups in vector order and preempts from its end, the order
+     * determines both who is scheduled first and who is preempted first.
+     */
+    void _order_by_priority(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        const auto now = SLOTracker::Clock::now();
+        bool has_priorities = false;
+        std::vector<uint64_t> request_ids;
+        request_ids.reserve(sequence_groups.size());
+        for (const auto& sequence_group : sequence_groups) {
+            const auto& sampling_params = sequence_group->get_sampling_parameters();
+            has_priorities |= sampling_params.priority > 0 || sampling_params.ttft_target_ms > 0 || sampling_params.tpot_target_ms > 0;
+            m_slo_tracker.update(sequence_group->get_request_id(), _get_num_generated_tokens(sequence_group), now);
+            request_ids.push_back(sequence_group->get_request_id());
+        }
+        m_slo_tracker.retain(request_ids);
+        m_min_admitted_priority = 0;
+        if (!has_priorities) {
+            return;
+        }
+
+        std::vector<std::pair<SequenceGroup::Ptr, double>> groups_with_slack;
+        groups_with_slack.reserve(sequence_groups.size());
+        for (const auto& sequence_group : sequence_groups) {
+            const auto& sampling_params = sequence_group->get_sampling_parameters();
+            double slack_ms = m_slo_tracker.get_slack_ms(sequence_group->get_request_id(), sampling_params.ttft_target_ms,
+                                                         sampling_params.tpot_target_ms, now);
+            if (slack_ms < 0 && !sequence_group->has_finished()) {
+                m_min_admitted_priority = std::max(m_min_admitted_priority, sampling_params.priority);
+            }
+            groups_with_slack.emplace_back(sequence_group, slack_ms);
+        }
+        std::stable_sort(groups_with_slack.begin(), groups_with_slack.end(), [](const auto& lhs, const auto& rhs) {
+            size_t lhs_priority = lhs.first->get_sampling_parameters().priority, rhs_priority = rhs.first->get_sampling_parameters().priority;
+            if (lhs_priority != rhs_priority) {
+                return lhs_priority > rhs_priority;
+            }
+            return lhs.second < rhs.second;
+        });
+        for (size_t i = 0; i < sequence_groups.size(); ++i) {
+            sequence_groups[i] = groups_with_slack[i].first;
+        }
+    }
+
+    /**
+     * Requests which have not started yet are held back while requests of a higher priority class miss their targets.
+     */
+    bool _is_admitted(const SequenceGroup::CPtr& sequence_group) const {
+        return sequence_group->get_sampling_parameters().priority >= m_min_admitted_priority ||
+               sequence_group->get_num_processed_tokens() > 0 || _get_num_generated_tokens(sequence_group) > 0;
+    }
+
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
         for (const SequenceGroup::CPtr& seq_group : sequence_groups) {
@@ -242,11 +510,11 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
-    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) const {
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
             SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
-            if (sequence_group->get_num_processed_tokens() > 0) {
+            if (sequence_group->get_num_processed_tokens() > 0 && !_is_swapped(sequence_group)) {
                 // we are here, because current sequence group has some reserved KV blocks in block manager
                 // which can be freed
                 return group_idx;
@@ -269,9 +537,13 @@ private:
                 break;
             }
             size_t blocks_needed = m_block_manager->required_blocks_count(sequence_group);
-            if (!_preempt_by_recompute(sequence_groups[evicted_sequence_group_id], blocks_needed)){
+            SequenceGroup::Ptr evicted_sequence_group = sequence_groups[evicted_sequence_group_id];
+            bool preempted = _can_preempt_by_swap(evicted_sequence_group) ? _preempt_by_swap(evicted_sequence_group)
+                                                                          : _preempt_by_recompute(evicted_sequence_group, blocks_needed);
+            if (!preempted) {
                 break;
             }
+            ++m_num_preempted_sequence_groups;
         }
     }
 
@@ -286,7 +558,7 @@ private:
 
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
-            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped(sequence_group) && _is_admitted(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -358,7 +630,8 @@ private:
 
     void _schedule_generate_phase_dynamic_split_fuse(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                                      Output& scheduler_output,
-                                                     std::map<size_t, std::list<size_t>>& block_copy_map) {
+                                                     std::map<size_t, std::list<size_t>>& block_copy_map,
+                                                     std::map<size_t, size_t>& block_num_filled_tokens) {
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             // Note, that can_generate_tokens will mix preempted sequence groups
@@ -366,7 +639,7 @@ private:
             // Question: do we need to schedule preeempted first as it's done in vLLM?
             // Answer: preempted sequences have low priority, so they should be after "running" ones. So, here we
             //         keep latencies for sequence groups of high priority
-            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped(sequence_group)) {
                 OPENVINO_ASSERT(!sequence_group->has_finished());
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 OPENVINO_ASSERT(num_running_seqs);
@@ -426,11 +699,16 @@ private:
 
 
                     // merge copy_blocks
+                    // copies are made only for the partially filled last block shared by forked sequences, which holds
+                    // the tokens cached beyond the preceding full blocks
+                    const size_t num_cached_tokens = sequence_group->get_num_processed_tokens() - sequence_group->get_num_evicted_tokens();
+                    const size_t num_filled_tokens = num_cached_tokens % sequence_group->get_block_size();
                     for (const auto& src_dst : copy_blocks_map) {
                         size_t src_index = src_dst.first;
                         const std::list<size_t>& dst_indexes = src_dst.second;
                         for (const auto dst_index : dst_indexes)
                             block_copy_map[src_index].push_back(dst_index);
+                        block_num_filled_tokens[src_index] = num_filled_tokens;
                     }
                 }
 
@@ -458,7 +736,7 @@ private:
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
-            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped(sequence_group) && _is_admitted(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
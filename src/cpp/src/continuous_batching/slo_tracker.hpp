@@ -0,0 +1,86 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Tracks the progress of requests against their latency targets.
+ *
+ * A request which has not generated tokens yet has to produce the first one within its time to first token (TTFT)
+ * target counted from the moment it was first seen; afterwards each next token is due within its time per output
+ * token (TPOT) target counted from the moment the previous one was observed. The time left until the nearest due
+ * moment (slack) is used by the scheduler to order requests within a priority class, most urgent first.
+ */
+class SLOTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double NO_DEADLINE = std::numeric_limits<double>::max();
+
+    /**
+     * Registers the number of tokens generated by the request so far.
+     */
+    void update(uint64_t request_id, size_t num_generated_tokens, Clock::time_point now) {
+        auto [it, inserted] = m_requests.try_emplace(request_id, RequestState{now, now, num_generated_tokens});
+        RequestState& state = it->second;
+        if (!inserted && num_generated_tokens > state.num_generated_tokens) {
+            state.last_token_time = now;
+        }
+        state.num_generated_tokens = std::max(state.num_generated_tokens, num_generated_tokens);
+    }
+
+    /**
+     * @return Time in milliseconds left until the request misses its next target (negative if it's already late),
+     * or NO_DEADLINE if the corresponding target is not set (zero) or the request is unknown.
+     */
+    double get_slack_ms(uint64_t request_id, size_t ttft_target_ms, size_t tpot_target_ms, Clock::time_point now) const {
+        auto it = m_requests.find(request_id);
+        if (it == m_requests.end()) {
+            return NO_DEADLINE;
+        }
+        const RequestState& state = it->second;
+        const bool is_first_token = state.num_generated_tokens == 0;
+        const size_t target_ms = is_first_token ? ttft_target_ms : tpot_target_ms;
+        if (target_ms == 0) {
+            return NO_DEADLINE;
+        }
+        const Clock::time_point since = is_first_token ? state.arrival_time : state.last_token_time;
+        const double elapsed_ms = std::chrono::duration<double, std::milli>(now - since).count();
+        return static_cast<double>(target_ms) - elapsed_ms;
+    }
+
+    /**
+     * Forgets the requests which are not in `request_ids`.
+     */
+    void retain(const std::vector<uint64_t>& request_ids) {
+        const std::unordered_set<uint64_t> retained(request_ids.begin(), request_ids.end());
+        for (auto it = m_requests.begin(); it != m_requests.end();) {
+            if (retained.find(it->first) == retained.end()) {
+                it = m_requests.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+private:
+    struct RequestState {
+        Clock::time_point arrival_time;
+        Clock::time_point last_token_time;
+        size_t num_generated_tokens;
+    };
+
+    std::unordered_map<uint64_t, RequestState> m_requests;
+};
+
+}  // namespace ov::genai
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/text_streamer.hpp"
@@ -100,5 +102,118 @@ private:
     }
 };
 
+/**
+ * Streams the outputs of all requests of one batched generate() call, each request to its own streamer, from a single
+ * background thread. Requests without a streamer are skipped; a request whose streamer returned STOP or CANCEL is not
+ * streamed anymore. A streamer is ended as soon as its request finishes, so every request gets its tokens and end()
+ * independently of the others.
+ */
+class ThreadedBatchStreamerWrapper {
+public:
+    ThreadedBatchStreamerWrapper(const std::vector<StreamerVariant>& streamers, Tokenizer& tokenizer)
+        : m_statuses(streamers.size()), m_is_ended(streamers.size(), false) {
+        m_streamer_ptrs.reserve(streamers.size());
+        for (size_t request_idx = 0; request_idx < streamers.size(); ++request_idx) {
+            m_streamer_ptrs.push_back(utils::create_streamer(streamers[request_idx], tokenizer));
+            m_has_callbacks = m_has_callbacks || m_streamer_ptrs.back() != nullptr;
+            m_statuses[request_idx] = StreamingStatus::RUNNING;
+        }
+    }
+
+    void start() {
+        if (!m_has_callbacks) {
+            return;
+        }
+
+        m_worker_thread = std::make_shared<std::thread>(&ThreadedBatchStreamerWrapper::_worker, this);
+    }
+
+    void write(size_t request_idx, const std::vector<int64_t>& tokens) {
+        if (!has_callback(request_idx) || tokens.empty() || m_is_ended[request_idx] || m_statuses[request_idx] != StreamingStatus::RUNNING) {
+            return;
+        }
+
+        m_squeue.push(std::make_pair(request_idx, tokens));
+    }
+
+    /**
+     * Ends the streamer of a finished request after the tokens written before.
+     */
+    void end_request(size_t request_idx) {
+        if (!has_callback(request_idx) || m_is_ended[request_idx]) {
+            return;
+        }
+
+        m_is_ended[request_idx] = true;
+        m_squeue.push(request_idx);
+    }
+
+    void end() {
+        if (!m_has_callbacks) {
+            return;
+        }
+
+        for (size_t request_idx = 0; request_idx < m_streamer_ptrs.size(); ++request_idx) {
+            end_request(request_idx);
+        }
+        // push stop token to unblock squeue.pull
+        m_squeue.push(std::monostate());
+
+        if (m_worker_thread && m_worker_thread->joinable()) {
+            m_worker_thread->join();
+        }
+    }
+
+    StreamingStatus get_status(size_t request_idx) const {
+        return m_statuses[request_idx];
+    }
+
+    bool has_callback(size_t request_idx) const {
+        return static_cast<bool>(m_streamer_ptrs[request_idx]);
+    }
+
+    bool has_callbacks() const {
+        return m_has_callbacks;
+    }
+
+private:
+    std::vector<std::shared_ptr<StreamerBase>> m_streamer_ptrs;
+    bool m_has_callbacks = false;
+    std::shared_ptr<std::thread> m_worker_thread = nullptr;
+    // { request index, tokens } to write, request index to end, or stop token
+    SynchronizedQueue<std::variant<std::pair<size_t, std::vector<int64_t>>, size_t, std::monostate>> m_squeue;
+
+    std::vector<std::atomic<StreamingStatus>> m_statuses;
+    // accessed by the producer only
+    std::vector<bool> m_is_ended;
+
+    void _worker() {
+        while (true) {
+            // wait for queue pull
+            auto value = m_squeue.pull();
+
+            if (auto tokens = std::get_if<std::pair<size_t, std::vector<int64_t>>>(&value)) {
+                const size_t request_idx = tokens->first;
+                if (m_statuses[request_idx] == StreamingStatus::RUNNING) {
+                    m_statuses[request_idx] = _get_streaming_status(m_streamer_ptrs[request_idx]->write(tokens->second));
+                }
+            } else if (auto request_idx = std::get_if<size_t>(&value)) {
+                m_streamer_ptrs[*request_idx]->end();
+            } else {
+                // stop token
+                break;
+            }
+        }
+    }
+
+    StreamingStatus _get_streaming_status(CallbackTypeVariant callback_status) {
+        if (auto status = std::get_if<StreamingStatus>(&callback_status)) {
+            return *status;
+        } else {
+            return std::get<bool>(callback_status) ? StreamingStatus::STOP : StreamingStatus::RUNNING;
+        }
+    }
+};
+
 }  // namespace genai
 }  // namespace ov
@@ -91,6 +91,8 @@ GenerationConfig::GenerationConfig(const std::filesystem::path& json_path) {
     read_json_param(data, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_json_param(data, "num_assistant_tokens", num_assistant_tokens);
     read_json_param(data, "max_ngram_size", max_ngram_size);
+    read_json_param(data, "num_assistant_branches", num_assistant_branches);
+    read_json_param(data, "adaptive_num_assistant_tokens", adaptive_num_assistant_tokens);
 
     // append EOS to stop_token_ids
     if (eos_token_id != -1)
@@ -150,6 +152,13 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_anymap_param(properties, "num_assistant_tokens", num_assistant_tokens);
     read_anymap_param(properties, "max_ngram_size", max_ngram_size);
+    read_anymap_param(properties, "num_assistant_branches", num_assistant_branches);
+    read_anymap_param(properties, "adaptive_num_assistant_tokens", adaptive_num_assistant_tokens);
+
+    // scheduling
+    read_anymap_param(properties, "priority", priority);
+    read_anymap_param(properties, "ttft_target_ms", ttft_target_ms);
+    read_anymap_param(properties, "tpot_target_ms", tpot_target_ms);
 
     // Structured output
     read_anymap_param(properties, "structured_output_config", structured_output_config);
@@ -357,6 +366,17 @@ void GenerationConfig::validate() const {
         OPENVINO_ASSERT(max_ngram_size == 0, "'max_ngram_size' should be set to default value 0 when prompt lookup is disabled");
     }
 
+    OPENVINO_ASSERT(num_assistant_branches > 0, "'num_assistant_branches' must be greater than 0");
+    if (num_assistant_branches > 1) {
+        OPENVINO_ASSERT(is_assisting_generation() && is_greedy_decoding() && !is_prompt_lookup(), "'num_assistant_branches' > 1 is supported only by speculative decoding with greedy decoding");
+        OPENVINO_ASSERT(repetition_penalty == 1.0f && presence_penalty == 0.0f && frequency_penalty == 0.0f && !is_structured_output_generation(),
+            "'num_assistant_branches' > 1 is not compatible with repetition penalties and structured output");
+    }
+    if (adaptive_num_assistant_tokens) {
+        OPENVINO_ASSERT(assistant_confidence_threshold == 0.0f && !is_prompt_lookup(),
+            "'adaptive_num_assistant_tokens' is supported only by speculative decoding with draft model and `num_assistant_tokens`");
+    }
+
     if(is_structured_output_generation()) {
         (*structured_output_config).validate();
     }
@@ -31,6 +31,7 @@
 #include "openvino/op/gather.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/shape_of.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -238,7 +239,7 @@ struct LoRAParameters {
     ov::Dimension rank;         // accumulated LoRA rank, could be dynamic if rank is not known or DYNAMIC mode is applied
     ov::element::Type type;     // element type of a tensor that will be applied to the model, negotiated based on multiple LoRA adapters
     bool fine_grained_alpha;    // use 1D tensor of the same rank for alpha instead of a scalar to blend multiple weighted LoRAs
-    // TODO: flag to have various alphas over the batch
+    std::vector<int32_t> column_adapters;   // index of adapter for each LoRA rank column, filled only if alphas vary over the tokens
 };
 
 using LoRAParametersGetter = std::function<std::optional<LoRAParameters>(NodePtr node)>;
@@ -320,6 +321,7 @@ struct LoRAParametersByWeightGetter {
     std::vector<LoRAWeightGetter> weight_getter;
     bool dynamic_lora_rank = true;
     bool fine_grained_alpha = true;
+    bool per_token_alpha = false;
     ov::element::Type type;
 
     std::optional<LoRAParameters> operator() (NodePtr node) const {
@@ -356,6 +358,15 @@ struct LoRAParametersByWeightGetter {
         result.rank = rank;
         result.type = type;
         result.fine_grained_alpha = fine_grained_alpha;
+        if(per_token_alpha) {
+            // The order of columns is the same as the order of concatenation in AdapterControllerImpl::collect_applicable_tensors
+            for(size_t i = 0; i < weight_getter.size(); ++i) {
+                if(auto nodes = weight_getter[i](node->get_friendly_name())) {
+                    auto adapter_rank = nodes->A->get_output_partial_shape(0)[0].get_length();
+                    result.column_adapters.insert(result.column_adapters.end(), adapter_rank, static_cast<int32_t>(i));
+                }
+            }
+        }
         return result;
     }
 };
@@ -406,20 +417,61 @@ namespace {
     }
 }
 
+// Selects LoRA adapters per token to mix requests with different adapters in a single inference.
+// A and B tensors of a layer are stacked over all registered adapters (as in the usual multi-adapter case),
+// so each LoRA rank column belongs to one adapter. Model inputs `lora_slot_ids` [num_tokens] and
+// `lora_slot_alphas` [num_slots, num_adapters] give the alpha of every adapter for every token:
+// alpha[token, column] = lora_slot_alphas[lora_slot_ids[token], adapter_of(column)], zero for adapters not used by a token.
+struct LoRAPerTokenAlpha {
+    std::shared_ptr<v0::Parameter> slot_ids;
+    std::shared_ptr<v0::Parameter> slot_alphas;
+
+    // Returns `alpha` multiplied by the per-token alphas reshaped to the layout of the activations of a given node
+    NodePtr operator() (NodePtr node, NodePtr alpha, const std::vector<int32_t>& column_adapters) const {
+        OPENVINO_ASSERT(std::dynamic_pointer_cast<v0::MatMul>(node),
+            "Per-request LoRA adapters are supported for MatMul layers only, but got ", node);
+
+        auto columns = v0::Constant::create(ov::element::i32, ov::Shape{column_adapters.size()}, column_adapters);
+        auto axis_0 = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        auto axis_1 = v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+        NodePtr token_alphas = std::make_shared<v8::Gather>(slot_alphas, slot_ids, axis_0);    // [num_tokens, num_adapters]
+        token_alphas = std::make_shared<v8::Gather>(token_alphas, columns, axis_1);             // [num_tokens, lora_rank]
+
+        // Tokens are laid out along the leading dimensions of activations, e.g. [num_tokens, 1, hidden] or [1, num_tokens, hidden]
+        auto activations = node->input_value(0);
+        auto activations_rank = activations.get_partial_shape().rank().get_length();
+        std::vector<int32_t> leading_dims(activations_rank - 1);
+        std::iota(leading_dims.begin(), leading_dims.end(), 0);
+        auto activations_shape = std::make_shared<v3::ShapeOf>(activations, ov::element::i32);
+        auto leading_shape = std::make_shared<v8::Gather>(
+            activations_shape,
+            v0::Constant::create(ov::element::i32, ov::Shape{leading_dims.size()}, leading_dims),
+            axis_0);
+        auto target_shape = std::make_shared<v0::Concat>(
+            ov::OutputVector{leading_shape, v0::Constant::create(ov::element::i32, ov::Shape{1}, {-1})}, 0);
+        token_alphas = std::make_shared<v1::Reshape>(token_alphas, target_shape, false);
+
+        return std::make_shared<v1::Multiply>(alpha, token_alphas);
+    }
+};
+
 // Creates ReadValue and Assign nodes to inject LoRA tensors as variables for a given node but
 // doesn't connect them to the model returning as LoRANode instance.
 struct LoRAWeightStateGetter {
     std::shared_ptr<ov::Model> model;
     LoRAParametersGetter params_getter;
     LoRAVarMap& variable_ids;
+    std::optional<LoRAPerTokenAlpha> per_token_alpha;
     // TODO: Use variable indices instead of variable_id for faster search for a state tensor
 
     LoRAWeightStateGetter(const LoRAParametersGetter& params_getter,
                           std::shared_ptr<ov::Model> model,
-                          LoRAVarMap& variable_ids)
+                          LoRAVarMap& variable_ids,
+                          const std::optional<LoRAPerTokenAlpha>& per_token_alpha = std::nullopt)
         : model(model),
           params_getter(params_getter),
-          variable_ids(variable_ids) {}
+          variable_ids(variable_ids),
+          per_token_alpha(per_token_alpha) {}
 
     std::optional<LoRANode> operator() (NodePtr node) const {
         if(auto params = params_getter(node)) {
@@ -449,6 +501,9 @@ struct LoRAWeightStateGetter {
                 variable_id_prefix + ".alpha"
             };
             result.alpha = add_variable(var_ids.alpha, model);
+            if(per_token_alpha) {
+                result.alpha = (*per_token_alpha)(node, result.alpha, params->column_adapters);
+            }
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.B = model->get_variables().size();
             var_ids.B = ov::op::util::VariableInfo{
@@ -679,7 +734,7 @@ NodePtr tensors_multiplication(NodePtr input,
                 input->get_rt_info()["decompression"];
             }
         }
-        if (normalized->get_output_partial_shape(0).rank().get_length() > 2) {
+        if (i != alpha_pos && normalized->get_output_partial_shape(0).rank().get_length() > 2) {
             // FIXME: Any other shape patterns possible?
             normalized = squeeze_2d(normalized);
         }
@@ -1291,13 +1346,39 @@ struct AdapterControllerImpl {
     // Needed to track which LoRA tensors were actually applied to suppress unused tensor warnings
     std::shared_ptr<LoRAWeightGetterDefault<NodePtr, NodePtr>> const_getter_impl;
 
-    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config) :
+    // Adapters registered at construction time that can be selected per token, empty if alphas are the same for all tokens
+    std::vector<Adapter> per_token_adapters;
+
+    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config, bool per_token = false) :
         current_config(config),  // FIXME: Compare current and passed configs and change incrementally
         lora_state_evaluators("CPU")    // FIXME: Try to run on the same device that is used for model inference
     {
         LoRAConstantGetter const_getter;
         LoRAParametersByWeightGetter params_getter;
         params_getter.type = ov::element::dynamic;
+        params_getter.per_token_alpha = per_token;
+
+        std::optional<LoRAPerTokenAlpha> per_token_alpha;
+        if(per_token) {
+            auto mode = current_config.get_mode();
+            OPENVINO_ASSERT(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK,
+                "Per-request LoRA adapters require AdapterConfig::MODE_DYNAMIC or AdapterConfig::MODE_STATIC_RANK");
+            per_token_adapters = current_config.get_adapters();
+            // Alphas are given per token by the model inputs, so the state keeps unit alphas for all adapters
+            for(const auto& adapter : per_token_adapters) {
+                current_config.set_alpha(adapter, 1.0f);
+            }
+
+            per_token_alpha = LoRAPerTokenAlpha{
+                std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{-1}),
+                std::make_shared<v0::Parameter>(ov::element::f32, ov::PartialShape{-1, static_cast<int64_t>(per_token_adapters.size())})
+            };
+            per_token_alpha->slot_ids->set_friendly_name("lora_slot_ids");
+            per_token_alpha->slot_ids->get_output_tensor(0).set_names({"lora_slot_ids"});
+            per_token_alpha->slot_alphas->set_friendly_name("lora_slot_alphas");
+            per_token_alpha->slot_alphas->get_output_tensor(0).set_names({"lora_slot_alphas"});
+            model->add_parameters({per_token_alpha->slot_ids, per_token_alpha->slot_alphas});
+        }
 
         for(auto const& adapter : current_config.get_adapters()) {
             auto adapter_impl = get_adapter_impl(adapter);
@@ -1363,7 +1444,7 @@ struct AdapterControllerImpl {
         if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
             // State mode
             params_getter.dynamic_lora_rank = (mode != AdapterConfig::MODE_STATIC_RANK);
-            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids));
+            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids, per_token_alpha));
             if (const_getter) {
                 LoRAStateGetterForConst getter = LoRAStateGetterForConst(const_getter, model, constant_variable_ids);
                 pm.register_pass<LoRAReplaceConstantTransformDynamic>(getter, getter.create_if_input());
@@ -1428,7 +1509,25 @@ struct AdapterControllerImpl {
         return diff;
     }
 
+    std::vector<float> get_per_token_alphas(const std::optional<AdapterConfig>& config) const {
+        OPENVINO_ASSERT(!per_token_adapters.empty(), "AdapterController was not configured to use per-request adapters");
+        std::vector<float> alphas(per_token_adapters.size(), 0.0f);
+        if(config) {
+            for(const auto& [adapter, alpha] : config->get_adapters_and_alphas()) {
+                auto it = std::find(per_token_adapters.begin(), per_token_adapters.end(), adapter);
+                OPENVINO_ASSERT(it != per_token_adapters.end(),
+                    "Per-request LoRA adapter was not registered in the adapters passed to the pipeline constructor");
+                alphas[it - per_token_adapters.begin()] = alpha;
+            }
+        }
+        return alphas;
+    }
+
     void apply (ov::InferRequest& infer_request, std::optional<AdapterConfig> config) {
+        // Adapters and alphas are selected by model inputs when per-request adapters are used, so the state is set once
+        if(!per_token_adapters.empty()) {
+            config = std::nullopt;
+        }
         // FIXME: If a part of LoRA state tensors are not set here, then need to carefully reset state in LLMPipeline where global reset is called after the generation
         ConfigChanged diff;
         if(config) {
@@ -1759,7 +1858,7 @@ struct AdapterControllerImpl {
 };
 
 
-AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device)
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_request_adapters)
 {
     // If AdapterConfig::MODE_AUTO is used, then set real mode depending on the device capabilities
     // TODO: Remove this code when devices become aligned on their capabilities for LoRA adapters
@@ -1776,7 +1875,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
         if(default_mode != default_modes.end()) {
             AdapterConfig updated_config = config;
             updated_config.set_mode(default_mode->second);
-            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config);
+            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config, per_request_adapters);
             return;
         } else {
             std::string device_msg;
@@ -1791,7 +1890,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
                 << "To avoid this warning set one of the AdapterConfig::Mode values except MODE_AUTO.";
         }
     }
-    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config);
+    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config, per_request_adapters);
 }
 
 
@@ -1809,6 +1908,11 @@ bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
 
+std::vector<float> AdapterController::get_per_request_alphas(const std::optional<AdapterConfig>& config) const {
+    OPENVINO_ASSERT(m_pimpl, "AdapterController was not configured to use adapters");
+    return m_pimpl->get_per_token_alphas(config);
+}
+
 
 void AdapterConfig::set_mode(Mode _mode) {
     mode = _mode;
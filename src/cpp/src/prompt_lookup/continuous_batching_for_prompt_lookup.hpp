@@ -6,6 +6,7 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "continuous_batching/pipeline_impl.hpp"
+#include "prompt_lookup/ngram_index.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -55,6 +56,7 @@ public:
 
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
-    TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
+    // sequence id -> n-gram index over its prompt and generated tokens, kept between steps
+    std::unordered_map<uint64_t, NgramIndex> m_ngram_indices;
 };
 }
@@ -0,0 +1,174 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Incrementally maintained n-gram table over the tokens of one sequence (prompt followed by generated tokens),
+ * used to look up prompt lookup decoding candidates without rescanning the whole sequence every step.
+ *
+ * For every n-gram size up to `max_ngram_size` the table maps the rolling hash of each n-gram to the position of its
+ * first occurrence and the number of its occurrences. Appending a token updates `max_ngram_size` entries, removing the
+ * last token reverts them, so the index can follow sequences whose tail is rolled back after candidate validation.
+ * Lookups compute the hashes of the trailing n-grams and cost O(max_ngram_size) regardless of the sequence length.
+ */
+class NgramIndex {
+    struct Entry {
+        // start position of the first occurrence of the n-gram
+        size_t first_pos;
+        size_t num_occurrences;
+    };
+
+    size_t m_max_ngram_size;
+    std::vector<int64_t> m_tokens;
+    // m_tables[ngram_size - 1]: n-gram hash -> entry
+    std::vector<std::unordered_map<uint64_t, Entry>> m_tables;
+
+    static uint64_t _extend_hash(uint64_t hash, int64_t token) {
+        // splitmix64 finalizer over the combined value
+        uint64_t x = hash ^ (static_cast<uint64_t>(token) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    // hashes[n - 1] is the hash of the n-gram which ends at `end` (exclusive), for n up to max_size
+    void _trailing_hashes(size_t end, size_t max_size, std::vector<uint64_t>& hashes) const {
+        hashes.resize(max_size);
+        uint64_t hash = 0;
+        for (size_t n = 1; n <= max_size; ++n) {
+            hash = _extend_hash(hash, m_tokens[end - n]);
+            hashes[n - 1] = hash;
+        }
+    }
+
+public:
+    explicit NgramIndex(size_t max_ngram_size) : m_max_ngram_size(max_ngram_size), m_tables(max_ngram_size) {}
+
+    size_t size() const {
+        return m_tokens.size();
+    }
+
+    size_t get_max_ngram_size() const {
+        return m_max_ngram_size;
+    }
+
+    const std::vector<int64_t>& get_tokens() const {
+        return m_tokens;
+    }
+
+    void append(int64_t token) {
+        m_tokens.push_back(token);
+        const size_t end = m_tokens.size();
+        const size_t max_size = std::min(m_max_ngram_size, end);
+        uint64_t hash = 0;
+        for (size_t n = 1; n <= max_size; ++n) {
+            hash = _extend_hash(hash, m_tokens[end - n]);
+            auto [it, inserted] = m_tables[n - 1].try_emplace(hash, Entry{end - n, 0});
+            ++it->second.num_occurrences;
+        }
+    }
+
+    void append(const std::vector<int64_t>& tokens) {
+        for (int64_t token : tokens) {
+            append(token);
+        }
+    }
+
+    /**
+     * Removes the tokens past `new_size`, reverting their n-gram entries.
+     */
+    void truncate(size_t new_size) {
+        OPENVINO_ASSERT(new_size <= m_tokens.size(), "Cannot truncate n-gram index to a larger size");
+        while (m_tokens.size() > new_size) {
+            const size_t end = m_tokens.size();
+            const size_t max_size = std::min(m_max_ngram_size, end);
+            uint64_t hash = 0;
+            for (size_t n = 1; n <= max_size; ++n) {
+                hash = _extend_hash(hash, m_tokens[end - n]);
+                auto it = m_tables[n - 1].find(hash);
+                OPENVINO_ASSERT(it != m_tables[n - 1].end(), "N-gram index is inconsistent");
+                if (--it->second.num_occurrences == 0) {
+                    m_tables[n - 1].erase(it);
+                }
+            }
+            m_tokens.pop_back();
+        }
+    }
+
+    /**
+     * Brings the index in sync with `prompt` followed by `generated` tokens, touching only the tokens which differ
+     * from the indexed ones. Appends in the common case, rolls back the tail if the generated tokens were shortened
+     * or replaced.
+     */
+    void sync(const std::vector<int64_t>& prompt, const std::vector<int64_t>& generated) {
+        const size_t prompt_len = prompt.size();
+        const size_t new_size = prompt_len + generated.size();
+        auto token_at = [&](size_t pos) {
+            return pos < prompt_len ? prompt[pos] : generated[pos - prompt_len];
+        };
+
+        // the last indexed token that is still in place normally confirms the whole indexed prefix:
+        // the prompt is immutable and generated tokens are only changed at the tail
+        size_t common = std::min(m_tokens.size(), new_size);
+        while (common > 0 && m_tokens[common - 1] != token_at(common - 1)) {
+            --common;
+        }
+        truncate(common);
+        for (size_t pos = common; pos < new_size; ++pos) {
+            append(token_at(pos));
+        }
+    }
+
+    /**
+     * Finds the earliest earlier occurrence of the longest trailing n-gram (up to `max_ngram_size`, limited to half
+     * of the sequence length) and returns up to `num_pred_tokens` tokens which followed it.
+     */
+    std::vector<int64_t> find_candidates(size_t num_pred_tokens, size_t max_ngram_size) const {
+        const size_t length = m_tokens.size();
+        if (num_pred_tokens == 0 || length == 0) {
+            return {};
+        }
+        max_ngram_size = std::min(max_ngram_size, m_max_ngram_size);
+        if (max_ngram_size >= length) {
+            // Comparing the whole sequence is not very meaningful until the ngram length reaches half the length of
+            // the sequence, because the ngrams will overlap with it.
+            max_ngram_size = length / 2;
+        }
+
+        std::vector<uint64_t> hashes;
+        _trailing_hashes(length, max_ngram_size, hashes);
+        for (size_t ngram_size = max_ngram_size; ngram_size > 0; --ngram_size) {
+            const auto& table = m_tables[ngram_size - 1];
+            auto it = table.find(hashes[ngram_size - 1]);
+            if (it == table.end()) {
+                continue;
+            }
+            const size_t match_pos = it->second.first_pos;
+            // the first occurrence is the trailing n-gram itself, so there is no earlier match
+            if (match_pos + ngram_size >= length) {
+                continue;
+            }
+            // guard against hash collisions
+            if (!std::equal(m_tokens.end() - ngram_size, m_tokens.end(), m_tokens.begin() + match_pos)) {
+                continue;
+            }
+            const size_t start_candidate_idx = match_pos + ngram_size;
+            const size_t available_num_pred = std::min(length - start_candidate_idx, num_pred_tokens);
+            return std::vector<int64_t>{m_tokens.begin() + start_candidate_idx,
+                                        m_tokens.begin() + start_candidate_idx + available_num_pred};
+        }
+        return {};
+    }
+};
+
+}  // namespace ov::genai
@@ -3,7 +3,10 @@
 
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 
 #include <nlohmann/json.hpp>
@@ -26,8 +29,11 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     properties_copy.erase(max_length.name());
     properties_copy.erase(pad_to_max_length.name());
     properties_copy.erase(batch_size.name());
+    properties_copy.erase(max_batch_tokens.name());
     properties_copy.erase(pooling_type.name());
     properties_copy.erase(normalize.name());
+    properties_copy.erase(embedding_dimensions.name());
+    properties_copy.erase(embedding_type.name());
     properties_copy.erase(embed_instruction.name());
     properties_copy.erase(query_instruction.name());
     properties_copy.erase(padding_side.name());
@@ -64,8 +70,11 @@ TextEmbeddingPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::pad_to_max_length.name(), pad_to_max_length);
     read_anymap_param(properties, ov::genai::batch_size.name(), batch_size);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
     read_anymap_param(properties, ov::genai::pooling_type.name(), pooling_type);
     read_anymap_param(properties, ov::genai::normalize.name(), normalize);
+    read_anymap_param(properties, ov::genai::embedding_dimensions.name(), embedding_dimensions);
+    read_anymap_param(properties, ov::genai::embedding_type.name(), embedding_type);
     read_anymap_param(properties, ov::genai::embed_instruction.name(), embed_instruction);
     read_anymap_param(properties, ov::genai::query_instruction.name(), query_instruction);
     read_anymap_param(properties, ov::genai::padding_side.name(), padding_side);
@@ -79,6 +88,10 @@ void TextEmbeddingPipeline::Config::validate() const {
     if (batch_size.has_value()) {
         OPENVINO_ASSERT(batch_size.value() > 0, "batch_size should be greater than 0");
     }
+
+    if (embedding_dimensions.has_value()) {
+        OPENVINO_ASSERT(embedding_dimensions.value() > 0, "embedding_dimensions should be greater than 0");
+    }
 }
 
 class TextEmbeddingPipeline::TextEmbeddingPipelineImpl {
@@ -129,6 +142,14 @@ public:
             auto compiled_model = core.compile_model(model, device, properties);
             utils::print_compiled_model_properties(compiled_model, "text embedding model");
             m_request = compiled_model.create_infer_request();
+
+            // micro-batches run on the pool in parallel
+            const uint32_t num_requests = compiled_model.get_property(ov::optimal_number_of_infer_requests);
+            m_micro_batch_requests.push_back(m_request);
+            for (uint32_t i = 1; i < num_requests; ++i) {
+                m_micro_batch_requests.push_back(compiled_model.create_infer_request());
+            }
+            m_running_micro_batches.resize(m_micro_batch_requests.size());
         }
     };
 
@@ -177,6 +198,21 @@ private:
     std::optional<size_t> m_max_position_embeddings;
     ov::Tensor m_attention_mask;
 
+    struct MicroBatch {
+        // indices of texts ordered by decreasing token length
+        std::vector<size_t> text_indices;
+        size_t sequence_length = 0;
+    };
+    std::vector<InferRequest> m_micro_batch_requests;
+    // index of micro-batch run by the corresponding request of m_micro_batch_requests
+    std::vector<std::optional<size_t>> m_running_micro_batches;
+    std::vector<MicroBatch> m_micro_batches;
+    size_t m_num_started_micro_batches = 0;
+    ov::Tensor m_input_ids;
+    // [offset, length] of tokens of each text in m_input_ids row
+    std::vector<std::pair<size_t, size_t>> m_token_spans;
+    EmbeddingResults m_embeddings;
+
     ov::Tensor post_model_infer(const ov::Tensor& input) {
         if (!m_post_request) {
             return input;
@@ -217,6 +253,150 @@ private:
     }
 
     void start_embed_async(std::vector<std::string>& texts) {
+        if (m_post_request) {
+            start_embed_single_batch_async(texts);
+            return;
+        }
+
+        const auto encoded = m_tokenizer.encode(texts, m_tokenization_params);
+        m_input_ids = encoded.input_ids;
+        m_attention_mask = encoded.attention_mask;
+        m_token_spans = utils::get_token_spans(m_attention_mask);
+        m_micro_batches = split_into_micro_batches(m_token_spans);
+        m_embeddings = create_embedding_results(texts.size());
+        m_num_started_micro_batches = 0;
+        for (size_t request_idx = 0; request_idx < m_micro_batch_requests.size(); ++request_idx) {
+            start_next_micro_batch(request_idx);
+        }
+    };
+
+    EmbeddingResults wait_embed() {
+        if (m_post_request) {
+            return wait_embed_single_batch();
+        }
+
+        // batches have similar number of tokens, so waiting in order doesn't leave requests idle for long
+        bool is_running = true;
+        while (is_running) {
+            is_running = false;
+            for (size_t request_idx = 0; request_idx < m_micro_batch_requests.size(); ++request_idx) {
+                if (!m_running_micro_batches[request_idx]) {
+                    continue;
+                }
+                m_micro_batch_requests[request_idx].wait();
+                collect_micro_batch(request_idx);
+                start_next_micro_batch(request_idx);
+                is_running = true;
+            }
+        }
+        return std::move(m_embeddings);
+    };
+
+    std::vector<MicroBatch> split_into_micro_batches(const std::vector<std::pair<size_t, size_t>>& token_spans) const {
+        std::vector<size_t> order(token_spans.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&token_spans](size_t lhs, size_t rhs) {
+            return token_spans[lhs].second > token_spans[rhs].second;
+        });
+
+        const bool is_padded_to_max_length = m_config.pad_to_max_length.value_or(false) && m_config.max_length;
+        std::vector<MicroBatch> micro_batches;
+        for (size_t begin = 0; begin < order.size();) {
+            MicroBatch micro_batch;
+            // the first text is the longest one
+            micro_batch.sequence_length = is_padded_to_max_length ? *m_config.max_length : std::max<size_t>(token_spans[order[begin]].second, 1);
+            size_t num_texts = order.size();
+            if (m_config.batch_size) {
+                num_texts = *m_config.batch_size;
+            } else if (m_config.max_batch_tokens > 0) {
+                num_texts = std::max<size_t>(m_config.max_batch_tokens / micro_batch.sequence_length, 1);
+            }
+            const size_t end = std::min(order.size(), begin + num_texts);
+            micro_batch.text_indices.assign(order.begin() + begin, order.begin() + end);
+            micro_batches.push_back(std::move(micro_batch));
+            begin = end;
+        }
+        return micro_batches;
+    }
+
+    void start_next_micro_batch(size_t request_idx) {
+        m_running_micro_batches[request_idx].reset();
+        if (m_num_started_micro_batches == m_micro_batches.size()) {
+            return;
+        }
+        const size_t micro_batch_idx = m_num_started_micro_batches++;
+        const MicroBatch& micro_batch = m_micro_batches[micro_batch_idx];
+
+        // the model shape is fixed if batch_size is set, the rest of the batch is filled up with the last text
+        const size_t num_rows = m_config.batch_size.value_or(micro_batch.text_indices.size());
+        const size_t sequence_length = micro_batch.sequence_length;
+        const bool is_left_padding = m_config.padding_side.has_value() && *m_config.padding_side == "left";
+        const int64_t pad_token_id = std::max<int64_t>(m_tokenizer.get_pad_token_id(), 0);
+        const size_t encoded_length = m_input_ids.get_shape()[1];
+
+        ov::Tensor input_ids{ov::element::i64, {num_rows, sequence_length}};
+        ov::Tensor attention_mask{ov::element::i64, {num_rows, sequence_length}};
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), pad_token_id);
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+        for (size_t row = 0; row < num_rows; ++row) {
+            const size_t text_idx = micro_batch.text_indices[std::min(row, micro_batch.text_indices.size() - 1)];
+            const auto [offset, length] = m_token_spans[text_idx];
+            const size_t destination = row * sequence_length + (is_left_padding ? sequence_length - length : 0);
+            std::copy_n(m_input_ids.data<int64_t>() + text_idx * encoded_length + offset, length, input_ids.data<int64_t>() + destination);
+            std::fill_n(attention_mask.data<int64_t>() + destination, length, 1);
+        }
+
+        InferRequest& request = m_micro_batch_requests[request_idx];
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+        // todo: pass token_type_ids from tokenizer
+        if (utils::has_token_type_ids_input(request.get_compiled_model().inputs())) {
+            ov::Tensor token_type_ids{ov::element::i64, input_ids.get_shape()};
+            std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+            request.set_tensor("token_type_ids", token_type_ids);
+        }
+        request.start_async();
+        m_running_micro_batches[request_idx] = micro_batch_idx;
+    }
+
+    void collect_micro_batch(size_t request_idx) {
+        // [batch_size, embedding_size]
+        const auto last_hidden_state = m_micro_batch_requests[request_idx].get_tensor("last_hidden_state");
+        const auto& text_indices = m_micro_batches[*m_running_micro_batches[request_idx]].text_indices;
+        scatter_embeddings(last_hidden_state, text_indices, m_embeddings);
+    }
+
+    EmbeddingResults create_embedding_results(size_t num_texts) const {
+        switch (m_config.embedding_type) {
+        case EmbeddingType::INT8:
+            return std::vector<std::vector<int8_t>>(num_texts);
+        case EmbeddingType::UBINARY:
+            return std::vector<std::vector<uint8_t>>(num_texts);
+        default:
+            return std::vector<std::vector<float>>(num_texts);
+        }
+    }
+
+    /**
+     * @brief Copies first text_indices.size() rows of embeddings tensor to results at text_indices.
+     * Element type of the tensor matches embedding_type since quantization is a part of the model.
+     */
+    static void scatter_embeddings(const Tensor& embeddings,
+                                   const std::vector<size_t>& text_indices,
+                                   EmbeddingResults& results) {
+        const size_t embedding_size = embeddings.get_shape()[1];
+        std::visit(
+            [&](auto& rows) {
+                using T = typename std::decay_t<decltype(rows)>::value_type::value_type;
+                const T* data = embeddings.data<T>();
+                for (size_t row = 0; row < text_indices.size(); ++row) {
+                    rows[text_indices[row]].assign(data + row * embedding_size, data + (row + 1) * embedding_size);
+                }
+            },
+            results);
+    }
+
+    void start_embed_single_batch_async(std::vector<std::string>& texts) {
         if (m_config.batch_size.has_value()) {
             // if batch_size is set, model shape is fixed
             // provide user friendly error message if number of texts is not equal to batch_size
@@ -243,7 +423,7 @@ private:
         m_request.start_async();
     };
 
-    EmbeddingResults wait_embed() {
+    EmbeddingResults wait_embed_single_batch() {
         m_request.wait();
 
         // [batch_size, hidden_size]
@@ -274,21 +454,12 @@ private:
     }
 
     EmbeddingResults to_embedding_result(const Tensor& last_hidden_state) {
-        const float* last_hidden_state_data = last_hidden_state.data<float>();
-
-        std::vector<std::vector<float>> result;
-        const auto shape = last_hidden_state.get_shape();
-
-        const size_t batch_size = shape[0];
-        const size_t hidden_size = shape[1];
-
-        for (size_t batch = 0; batch < batch_size; batch++) {
-            const auto batch_offset = batch * hidden_size;
-            const float* batch_data = last_hidden_state_data + batch_offset;
-            const std::vector<float> batch_result(batch_data, batch_data + hidden_size);
-            result.push_back(batch_result);
-        }
+        const size_t batch_size = last_hidden_state.get_shape()[0];
+        std::vector<size_t> text_indices(batch_size);
+        std::iota(text_indices.begin(), text_indices.end(), 0);
 
+        EmbeddingResults result = create_embedding_results(batch_size);
+        scatter_embeddings(last_hidden_state, text_indices, result);
         return result;
     }
 };
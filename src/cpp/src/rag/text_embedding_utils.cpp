@@ -120,6 +120,99 @@ std::shared_ptr<op::Op> create_normalize_ops(const ov::Output<ov::Node>& input,
     return std::dynamic_pointer_cast<op::Op>(input.get_node_shared_ptr());
 }
 
+/**
+ * Matryoshka truncation keeps first embedding_dimensions values
+ * [batch_size, hidden_size] -> [batch_size, embedding_dimensions]
+ */
+std::shared_ptr<op::Op> create_truncate_ops(const ov::Output<ov::Node>& input,
+                                            const TextEmbeddingPipeline::Config& config) {
+    const auto hidden_size = input.get_partial_shape()[1];
+    const auto embedding_dimensions = static_cast<int64_t>(config.embedding_dimensions.value());
+    OPENVINO_ASSERT(hidden_size.is_dynamic() || embedding_dimensions <= hidden_size.get_length(),
+                    "embedding_dimensions (",
+                    embedding_dimensions,
+                    ") should not be greater than model's hidden size (",
+                    hidden_size,
+                    ")");
+
+    auto start = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{0});
+    auto stop =
+        std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{embedding_dimensions});
+    auto step = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    auto axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+
+    return std::make_shared<op::v8::Slice>(input, start, stop, step, axis);
+}
+
+/**
+ * INT8 quantization scales each embedding by 127 / max(abs(embedding))
+ * [batch_size, hidden_size] f32 -> [batch_size, hidden_size] i8
+ */
+std::shared_ptr<op::Op> get_int8_quantization_op(const ov::Output<ov::Node>& input) {
+    auto abs = std::make_shared<op::v0::Abs>(input);
+    auto axis_1 = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    auto max_abs = std::make_shared<op::v1::ReduceMax>(abs, axis_1, true);
+
+    auto nearest_to_zero =
+        std::make_shared<op::v0::Constant>(input.get_element_type(), ov::Shape{1}, std::vector<float>{1e-12});
+    auto max_abs_clamped = std::make_shared<op::v1::Maximum>(max_abs, nearest_to_zero);
+
+    auto int8_max = std::make_shared<op::v0::Constant>(input.get_element_type(), ov::Shape{1}, std::vector<float>{127});
+    auto scale = std::make_shared<op::v1::Divide>(int8_max, max_abs_clamped);
+    auto scaled = std::make_shared<op::v1::Multiply>(input, scale);
+    auto rounded = std::make_shared<op::v5::Round>(scaled, op::v5::Round::RoundMode::HALF_TO_EVEN);
+
+    return std::make_shared<op::v0::Convert>(rounded, ov::element::i8);
+}
+
+/**
+ * UBINARY quantization packs signs of values into bits, the most significant bit first.
+ * Embedding is padded with zero bits to a multiple of 8.
+ * [batch_size, hidden_size] f32 -> [batch_size, ceil(hidden_size / 8)] u8
+ */
+std::shared_ptr<op::Op> get_ubinary_quantization_op(const ov::Output<ov::Node>& input) {
+    const auto hidden_size = input.get_partial_shape()[1];
+    OPENVINO_ASSERT(hidden_size.is_static(), "UBINARY embedding type requires static hidden size of the model");
+    const int64_t num_bytes = (hidden_size.get_length() + 7) / 8;
+
+    auto zero = std::make_shared<op::v0::Constant>(input.get_element_type(), ov::Shape{1}, std::vector<float>{0});
+    auto is_positive = std::make_shared<op::v1::Greater>(input, zero);
+    std::shared_ptr<ov::Node> bits = std::make_shared<op::v0::Convert>(is_positive, ov::element::i32);
+
+    if (num_bytes * 8 != hidden_size.get_length()) {
+        auto pads_begin = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{0, 0});
+        auto pads_end = std::make_shared<op::v0::Constant>(ov::element::i64,
+                                                           ov::Shape{2},
+                                                           std::vector<int64_t>{0, num_bytes * 8 - hidden_size.get_length()});
+        auto pad_value = std::make_shared<op::v0::Constant>(ov::element::i32, ov::Shape{}, std::vector<int32_t>{0});
+        bits = std::make_shared<op::v1::Pad>(bits, pads_begin, pads_end, pad_value, op::PadMode::CONSTANT);
+    }
+
+    // [batch_size, num_bytes * 8] -> [batch_size, num_bytes, 8]
+    auto bytes_shape =
+        std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{3}, std::vector<int64_t>{0, num_bytes, 8});
+    auto bytes = std::make_shared<op::v1::Reshape>(bits, bytes_shape, true);
+
+    auto bit_weights = std::make_shared<op::v0::Constant>(ov::element::i32,
+                                                          ov::Shape{8},
+                                                          std::vector<int32_t>{128, 64, 32, 16, 8, 4, 2, 1});
+    auto weighted_bits = std::make_shared<op::v1::Multiply>(bytes, bit_weights);
+    auto axis_2 = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+    auto packed = std::make_shared<op::v1::ReduceSum>(weighted_bits, axis_2);
+
+    return std::make_shared<op::v0::Convert>(packed, ov::element::u8);
+}
+
+std::shared_ptr<op::Op> create_quantization_ops(const ov::Output<ov::Node>& input,
+                                                const TextEmbeddingPipeline::Config& config) {
+    if (config.embedding_type == TextEmbeddingPipeline::EmbeddingType::INT8) {
+        return get_int8_quantization_op(input);
+    } else if (config.embedding_type == TextEmbeddingPipeline::EmbeddingType::UBINARY) {
+        return get_ubinary_quantization_op(input);
+    }
+    return std::dynamic_pointer_cast<op::Op>(input.get_node_shared_ptr());
+}
+
 }  // namespace
 
 namespace ov {
@@ -134,12 +227,24 @@ std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const
         return create_post_ops(node, attention_mask, config);
     });
 
+    if (config.embedding_dimensions) {
+        processor.output().postprocess().custom([&config](const ov::Output<ov::Node>& node) {
+            return create_truncate_ops(node, config);
+        });
+    }
+
     if (config.normalize) {
         processor.output().postprocess().custom([&config](const ov::Output<ov::Node>& node) {
             return create_normalize_ops(node, config);
         });
     }
 
+    if (config.embedding_type != TextEmbeddingPipeline::EmbeddingType::FLOAT) {
+        processor.output().postprocess().custom([&config](const ov::Output<ov::Node>& node) {
+            return create_quantization_ops(node, config);
+        });
+    }
+
     return processor.build();
 }
 
@@ -154,11 +259,16 @@ std::shared_ptr<ov::Model> create_post_model(std::shared_ptr<ov::Model> model,
     auto attention_mask = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{1, -1});
     set_node_name(attention_mask, "attention_mask");
 
-    auto post_output = create_post_ops(input_param, attention_mask, config);
+    std::shared_ptr<op::Op> post_output = create_post_ops(input_param, attention_mask, config);
+    if (config.embedding_dimensions) {
+        post_output = create_truncate_ops(post_output, config);
+    }
     auto post_normalize_output = create_normalize_ops(post_output, config);
     OPENVINO_ASSERT(post_normalize_output != nullptr);
+    auto post_quantization_output = create_quantization_ops(post_normalize_output, config);
+    OPENVINO_ASSERT(post_quantization_output != nullptr);
 
-    auto result_node = std::make_shared<ov::op::v0::Result>(post_normalize_output);
+    auto result_node = std::make_shared<ov::op::v0::Result>(post_quantization_output);
     set_node_name(result_node, "last_hidden_state");
     auto post_model =
         std::make_shared<ov::Model>(ov::OutputVector{result_node}, ov::ParameterVector{input_param, attention_mask});
@@ -3,11 +3,14 @@
 
 #include "openvino/genai/rag/text_rerank_pipeline.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
 
 #include "debug_utils.hpp"
 #include "json_utils.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
@@ -25,6 +28,7 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     properties_copy.erase(max_length.name());
     properties_copy.erase(pad_to_max_length.name());
     properties_copy.erase(padding_side.name());
+    properties_copy.erase(max_batch_tokens.name());
 
     return properties_copy;
 }
@@ -142,6 +146,7 @@ TextRerankPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::padding_side.name(), padding_side);
     read_anymap_param(properties, ov::genai::pad_to_max_length.name(), pad_to_max_length);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
 };
 
 class TextRerankPipeline::TextRerankPipelineImpl {
@@ -189,6 +194,16 @@ public:
 
         utils::print_compiled_model_properties(compiled_model, "text rerank model");
         m_request = compiled_model.create_infer_request();
+
+        // micro-batches of stateless models run on the pool in parallel,
+        // stateful models run them one by one on top of the shared prefix in KV cache
+        const uint32_t num_requests =
+            m_has_beam_idx ? 1 : compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        m_micro_batch_requests.push_back(m_request);
+        for (uint32_t i = 1; i < num_requests; ++i) {
+            m_micro_batch_requests.push_back(compiled_model.create_infer_request());
+        }
+        m_running_micro_batches.resize(m_micro_batch_requests.size());
     };
 
     std::vector<std::pair<size_t, float>> rerank(const std::string& query, const std::vector<std::string>& texts) {
@@ -197,46 +212,46 @@ public:
     }
 
     void start_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
-        const TokenizedInputs& encoded = tokenize(query, texts);
-
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
-
-        if (encoded.token_type_ids.has_value()) {
-            m_request.set_tensor("token_type_ids", *encoded.token_type_ids);
-        }
-
-        if (m_has_position_ids) {
-            ov::Tensor position_ids(encoded.input_ids.get_element_type(), encoded.input_ids.get_shape());
-            utils::initialize_position_ids(position_ids, encoded.attention_mask, 0);
-            m_request.set_tensor("position_ids", position_ids);
+        m_encoded = tokenize(query, texts);
+        m_token_spans = utils::get_token_spans(m_encoded.attention_mask);
+        m_is_left_padding = (m_config.padding_side.has_value() && *m_config.padding_side == "left") ||
+                            std::any_of(m_token_spans.begin(), m_token_spans.end(), [](const auto& span) {
+                                return span.first > 0;
+                            });
+
+        m_prefix_length = get_shared_prefix_length();
+        if (m_prefix_length > 0) {
+            prefill_prefix();
         }
 
-        if (m_has_beam_idx) {
-            const size_t batch_size = encoded.input_ids.get_shape()[0];
-            ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {batch_size});
-            std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
-            m_request.set_tensor("beam_idx", beam_idx);
+        m_micro_batches = split_into_micro_batches();
+        m_scores.assign(texts.size(), 0.0f);
+        m_num_started_micro_batches = 0;
+        for (size_t request_idx = 0; request_idx < m_micro_batch_requests.size(); ++request_idx) {
+            start_next_micro_batch(request_idx);
         }
-
-        m_request.start_async();
     }
 
     std::vector<std::pair<size_t, float>> wait_rerank() {
-        m_request.wait();
-
-        // postprocessing applied to output, it's the scores tensor
-        auto scores_tensor = m_request.get_tensor("logits");
-        auto scores_tensor_shape = scores_tensor.get_shape();
-        const size_t batch_size = scores_tensor_shape[0];
-
-        auto scores_data = scores_tensor.data<float>();
+        bool is_running = true;
+        while (is_running) {
+            is_running = false;
+            for (size_t request_idx = 0; request_idx < m_micro_batch_requests.size(); ++request_idx) {
+                if (!m_running_micro_batches[request_idx]) {
+                    continue;
+                }
+                m_micro_batch_requests[request_idx].wait();
+                collect_micro_batch(request_idx);
+                start_next_micro_batch(request_idx);
+                is_running = true;
+            }
+        }
 
         std::vector<std::pair<size_t, float>> results;
-        results.reserve(batch_size);
+        results.reserve(m_scores.size());
 
-        for (size_t batch = 0; batch < batch_size; batch++) {
-            results.emplace_back(batch, scores_data[batch]);
+        for (size_t text_idx = 0; text_idx < m_scores.size(); text_idx++) {
+            results.emplace_back(text_idx, m_scores[text_idx]);
         }
 
         const size_t top_n = m_config.top_n;
@@ -255,6 +270,7 @@ public:
 
         if (m_has_beam_idx) {
             m_request.reset_state();
+            m_prefix_states.clear();
         }
 
         return results;
@@ -268,6 +284,204 @@ private:
     bool m_has_position_ids = false;
     bool m_has_beam_idx = false;
 
+    struct MicroBatch {
+        // indices of texts ordered by decreasing token length
+        std::vector<size_t> text_indices;
+        // number of tokens after the shared prefix
+        size_t sequence_length = 0;
+    };
+    std::vector<InferRequest> m_micro_batch_requests;
+    // index of micro-batch run by the corresponding request of m_micro_batch_requests
+    std::vector<std::optional<size_t>> m_running_micro_batches;
+    std::vector<MicroBatch> m_micro_batches;
+    size_t m_num_started_micro_batches = 0;
+    TokenizedInputs m_encoded;
+    // [offset, length] of tokens of each text in m_encoded row
+    std::vector<std::pair<size_t, size_t>> m_token_spans;
+    bool m_is_left_padding = false;
+    // number of leading tokens shared by all texts, they are inferred once and their KV cache is reused
+    size_t m_prefix_length = 0;
+    // states of m_request after the shared prefix, restored before each micro-batch
+    std::vector<ov::Tensor> m_prefix_states;
+    std::vector<float> m_scores;
+
+    /**
+     * @brief Returns number of leading tokens shared by all encoded texts which can be inferred once.
+     * Tokens are compared instead of the query, so merges at the query-document boundary are taken into account.
+     * It's only supported for stateful decoder models, each text keeps at least one own token to score.
+     */
+    size_t get_shared_prefix_length() const {
+        if (!m_has_beam_idx || !m_has_position_ids || m_encoded.token_type_ids.has_value() ||
+            m_token_spans.size() < 2) {
+            return 0;
+        }
+
+        const size_t shortest_length =
+            std::min_element(m_token_spans.begin(), m_token_spans.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second < rhs.second;
+            })->second;
+        if (shortest_length < 2) {
+            return 0;
+        }
+
+        const size_t row_length = m_encoded.input_ids.get_shape()[1];
+        const int64_t* input_ids = m_encoded.input_ids.data<int64_t>();
+        const int64_t* first_text = input_ids + m_token_spans[0].first;
+        size_t prefix_length = shortest_length - 1;
+        for (size_t text_idx = 1; text_idx < m_token_spans.size() && prefix_length > 0; ++text_idx) {
+            const int64_t* text = input_ids + text_idx * row_length + m_token_spans[text_idx].first;
+            prefix_length = std::mismatch(first_text, first_text + prefix_length, text).first - first_text;
+        }
+        return prefix_length;
+    }
+
+    void prefill_prefix() {
+        m_request.reset_state();
+
+        ov::Tensor input_ids{ov::element::i64, {1, m_prefix_length}};
+        std::copy_n(m_encoded.input_ids.data<int64_t>() + m_token_spans[0].first,
+                    m_prefix_length,
+                    input_ids.data<int64_t>());
+        ov::Tensor attention_mask = utils::init_attention_mask(input_ids);
+        ov::Tensor position_ids{ov::element::i64, input_ids.get_shape()};
+        utils::initialize_position_ids(position_ids, attention_mask, 0);
+        ov::Tensor beam_idx{ov::element::i32, {1}};
+        beam_idx.data<int32_t>()[0] = 0;
+
+        m_request.set_tensor("input_ids", input_ids);
+        m_request.set_tensor("attention_mask", attention_mask);
+        m_request.set_tensor("position_ids", position_ids);
+        m_request.set_tensor("beam_idx", beam_idx);
+        m_request.infer();
+
+        m_prefix_states.clear();
+        for (auto& state : m_request.query_state()) {
+            const ov::Tensor state_tensor = state.get_state();
+            ov::Tensor prefix_state{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(prefix_state);
+            m_prefix_states.push_back(prefix_state);
+        }
+    }
+
+    std::vector<MicroBatch> split_into_micro_batches() const {
+        std::vector<size_t> order(m_token_spans.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) {
+            return m_token_spans[lhs].second > m_token_spans[rhs].second;
+        });
+
+        const bool is_padded_to_max_length = m_config.pad_to_max_length.value_or(false) && m_config.max_length;
+        std::vector<MicroBatch> micro_batches;
+        for (size_t begin = 0; begin < order.size();) {
+            MicroBatch micro_batch;
+            // the first text is the longest one
+            const size_t length = is_padded_to_max_length ? *m_config.max_length : m_token_spans[order[begin]].second;
+            micro_batch.sequence_length = std::max<size_t>(length - m_prefix_length, 1);
+            size_t num_texts = order.size();
+            if (m_config.max_batch_tokens > 0) {
+                num_texts = std::max<size_t>(m_config.max_batch_tokens / micro_batch.sequence_length, 1);
+            }
+            const size_t end = std::min(order.size(), begin + num_texts);
+            micro_batch.text_indices.assign(order.begin() + begin, order.begin() + end);
+            micro_batches.push_back(std::move(micro_batch));
+            begin = end;
+        }
+        return micro_batches;
+    }
+
+    void start_next_micro_batch(size_t request_idx) {
+        m_running_micro_batches[request_idx].reset();
+        if (m_num_started_micro_batches == m_micro_batches.size()) {
+            return;
+        }
+        const size_t micro_batch_idx = m_num_started_micro_batches++;
+        const MicroBatch& micro_batch = m_micro_batches[micro_batch_idx];
+
+        const size_t num_rows = micro_batch.text_indices.size();
+        const size_t sequence_length = micro_batch.sequence_length;
+        const int64_t pad_token_id = std::max<int64_t>(m_tokenizer.get_pad_token_id(), 0);
+        const size_t encoded_length = m_encoded.input_ids.get_shape()[1];
+
+        ov::Tensor input_ids{ov::element::i64, {num_rows, sequence_length}};
+        // attention mask covers the shared prefix in KV cache as well
+        ov::Tensor attention_mask{ov::element::i64, {num_rows, m_prefix_length + sequence_length}};
+        ov::Tensor token_type_ids;
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), pad_token_id);
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+        if (m_encoded.token_type_ids.has_value()) {
+            token_type_ids = ov::Tensor{ov::element::i64, input_ids.get_shape()};
+            std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+        }
+
+        for (size_t row = 0; row < num_rows; ++row) {
+            const size_t text_idx = micro_batch.text_indices[row];
+            const size_t source = text_idx * encoded_length + m_token_spans[text_idx].first + m_prefix_length;
+            const size_t length = m_token_spans[text_idx].second - m_prefix_length;
+            const size_t padding = m_is_left_padding ? sequence_length - length : 0;
+
+            std::copy_n(m_encoded.input_ids.data<int64_t>() + source,
+                        length,
+                        input_ids.data<int64_t>() + row * sequence_length + padding);
+            int64_t* row_attention_mask = attention_mask.data<int64_t>() + row * (m_prefix_length + sequence_length);
+            std::fill_n(row_attention_mask, m_prefix_length, 1);
+            std::fill_n(row_attention_mask + m_prefix_length + padding, length, 1);
+            if (token_type_ids) {
+                std::copy_n(m_encoded.token_type_ids->data<int64_t>() + source,
+                            length,
+                            token_type_ids.data<int64_t>() + row * sequence_length + padding);
+            }
+        }
+
+        InferRequest& request = m_micro_batch_requests[request_idx];
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+
+        if (token_type_ids) {
+            request.set_tensor("token_type_ids", token_type_ids);
+        }
+
+        if (m_has_position_ids) {
+            // positions of own tokens of texts continue the shared prefix
+            ov::Tensor own_attention_mask{ov::element::i64, input_ids.get_shape()};
+            for (size_t row = 0; row < num_rows; ++row) {
+                std::copy_n(attention_mask.data<int64_t>() + row * (m_prefix_length + sequence_length) + m_prefix_length,
+                            sequence_length,
+                            own_attention_mask.data<int64_t>() + row * sequence_length);
+            }
+            ov::Tensor position_ids{ov::element::i64, input_ids.get_shape()};
+            utils::initialize_position_ids(position_ids, own_attention_mask, m_prefix_length);
+            request.set_tensor("position_ids", position_ids);
+        }
+
+        if (m_has_beam_idx) {
+            if (m_prefix_length > 0) {
+                auto states = request.query_state();
+                for (size_t state_idx = 0; state_idx < states.size(); ++state_idx) {
+                    states[state_idx].set_state(m_prefix_states[state_idx]);
+                }
+            } else {
+                request.reset_state();
+            }
+            // all texts continue the single shared prefix
+            ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {num_rows});
+            std::fill_n(beam_idx.data<int32_t>(), num_rows, 0);
+            request.set_tensor("beam_idx", beam_idx);
+        }
+
+        request.start_async();
+        m_running_micro_batches[request_idx] = micro_batch_idx;
+    }
+
+    void collect_micro_batch(size_t request_idx) {
+        // postprocessing applied to output, it's the scores tensor
+        const auto scores_tensor = m_micro_batch_requests[request_idx].get_tensor("logits");
+        const float* scores_data = scores_tensor.data<float>();
+        const auto& text_indices = m_micro_batches[*m_running_micro_batches[request_idx]].text_indices;
+        for (size_t row = 0; row < text_indices.size(); ++row) {
+            m_scores[text_indices[row]] = scores_data[row];
+        }
+    }
+
     TokenizedInputs tokenize(const std::string& query, const std::vector<std::string>& texts) {
         if (m_tokenizer.supports_paired_input()) {
             return m_tokenizer.encode({query}, texts, m_tokenization_params);
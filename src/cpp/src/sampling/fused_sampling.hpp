@@ -0,0 +1,304 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "sampling/logit_transformers.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Parameters of the top_k -> temperature -> top_p -> multinomial draw chain, executed by FusedSamplingKernel
+ * instead of the separate TopKFilter, TemperatureLogitTransform and TopPFilter transforms.
+ */
+struct FusedSamplingParams {
+    // 0 or >= vocabulary size disables top_k filtering
+    size_t top_k = 0;
+    float temperature = 1.0f;
+    float top_p = 1.0f;
+};
+
+/**
+ * @brief Streaming sampling kernel over a full vocabulary row of raw (already penalized) logits.
+ *
+ * The row is never copied into a `std::vector<Token>` and is not modified. Depending on the active filters:
+ *   - top_k:           one pass selecting K candidates with a min-heap, skipping whole blocks whose maximum does not
+ *                      beat the current K-th candidate; temperature, top_p and the draw run over the K candidates.
+ *   - top_p only:      a max pass, a pass computing softmax weights and a histogram of the probability mass over
+ *                      (max - logit) / T; only tokens from the bins which hold the nucleus are gathered and sorted.
+ *   - neither:         a max pass and a pass computing softmax weights; the draw scans the cached weights.
+ * Inner loops work on blocks of independent lanes so that the compiler vectorizes them for the target ISA.
+ * Scratch buffers are kept between calls, so steady-state sampling does not allocate. An instance must not be
+ * shared between threads.
+ */
+class FusedSamplingKernel {
+public:
+    static constexpr size_t NUM_BINS = 1024;
+    // the last histogram bin collects tokens with probability below exp(-BIN_RANGE) of the most probable one
+    static constexpr float BIN_RANGE = 32.0f;
+    static constexpr size_t BLOCK_SIZE = 16;
+
+    static float max_value(const float* data, size_t size) {
+        constexpr size_t LANES = 8;
+        float lanes[LANES];
+        std::fill(lanes, lanes + LANES, -std::numeric_limits<float>::infinity());
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                lanes[lane] = data[i + lane] > lanes[lane] ? data[i + lane] : lanes[lane];
+            }
+        }
+        for (; i < size; ++i) {
+            lanes[0] = data[i] > lanes[0] ? data[i] : lanes[0];
+        }
+        return *std::max_element(lanes, lanes + LANES);
+    }
+
+    /**
+     * @return Index of the first maximum of the row, or 0 if the row contains no comparable values.
+     */
+    static size_t argmax(const float* data, size_t size) {
+        const float max_logit = max_value(data, size);
+        size_t i = 0;
+        for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+            int32_t num_found = 0;
+            for (size_t lane = 0; lane < BLOCK_SIZE; ++lane) {
+                num_found += data[i + lane] == max_logit;
+            }
+            if (num_found > 0) {
+                break;
+            }
+        }
+        for (; i < size; ++i) {
+            if (data[i] == max_logit) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Draws `num_tokens` tokens from the row and appends them to `out_tokens`. Token log probabilities are normalized
+     * over the candidates which remain after filtering, as with the transform chain.
+     */
+    void sample(const float* data, size_t size, const FusedSamplingParams& params, size_t num_tokens,
+                std::mt19937& rng_engine, std::vector<Token>& out_tokens) {
+        OPENVINO_ASSERT(size > 0, "Cannot sample from an empty logits row");
+        OPENVINO_ASSERT(params.temperature > 0.0f, "Temperature must be positive for multinomial sampling");
+        const float inv_temperature = 1.0f / params.temperature;
+        const bool top_k_active = params.top_k > 0 && params.top_k < size;
+        const bool top_p_active = params.top_p < 1.0f;
+
+        m_candidates.clear();
+        float max_logit = 0.0f;
+        // sum of the weights the top_p threshold is relative to
+        float total_weight = 0.0f;
+        if (top_k_active) {
+            _select_top_k(data, size, params.top_k);
+            max_logit = _max_candidate_logit();
+            _sort_candidates();
+            _compute_candidate_weights(max_logit, inv_temperature);
+            for (float weight : m_weights) {
+                total_weight += weight;
+            }
+        } else if (top_p_active) {
+            max_logit = max_value(data, size);
+            total_weight = _compute_row_weights(data, size, max_logit, inv_temperature, true);
+            _gather_nucleus_bins(data, size, max_logit, inv_temperature, params.top_p * total_weight);
+            _sort_candidates();
+            _compute_candidate_weights(max_logit, inv_temperature);
+        } else {
+            max_logit = max_value(data, size);
+            total_weight = _compute_row_weights(data, size, max_logit, inv_temperature, false);
+            _draw_from_row(data, size, max_logit, inv_temperature, total_weight, num_tokens, rng_engine, out_tokens);
+            return;
+        }
+
+        size_t num_candidates = m_candidates.size();
+        if (top_p_active) {
+            // keep the smallest prefix of the descending candidates whose probability exceeds top_p
+            const float threshold = params.top_p * total_weight;
+            float cumulative_weight = 0.0f;
+            for (size_t i = 0; i < m_candidates.size(); ++i) {
+                cumulative_weight += m_weights[i];
+                if (cumulative_weight > threshold) {
+                    num_candidates = i + 1;
+                    break;
+                }
+            }
+        }
+        _draw(num_candidates, num_tokens, rng_engine, out_tokens);
+    }
+
+private:
+    std::array<float, NUM_BINS> m_bin_mass;
+    std::vector<Token> m_candidates;
+    // weights of the sorted candidates
+    std::vector<float> m_weights;
+    // weights of the whole row when no top_k filtering is done
+    std::vector<float> m_row_weights;
+
+    static size_t _bin(float logit, float max_logit, float inv_temperature) {
+        const float distance = (max_logit - logit) * inv_temperature;
+        // NaN and infinite distances go to the last bin as well
+        return distance < BIN_RANGE ? static_cast<size_t>(distance * (NUM_BINS / BIN_RANGE)) : NUM_BINS - 1;
+    }
+
+    float _max_candidate_logit() const {
+        float max_logit = -std::numeric_limits<float>::infinity();
+        for (const auto& candidate : m_candidates) {
+            max_logit = std::max(max_logit, candidate.m_log_prob);
+        }
+        return max_logit;
+    }
+
+    void _select_top_k(const float* data, size_t size, size_t top_k) {
+        static const auto min_cmp = [](const Token& a, const Token& b) {
+            return a.m_log_prob > b.m_log_prob;  // inverted: makes std::*_heap a min-heap
+        };
+        for (size_t i = 0; i < top_k; ++i) {
+            m_candidates.emplace_back(data[i], static_cast<int64_t>(i));
+        }
+        std::make_heap(m_candidates.begin(), m_candidates.end(), min_cmp);
+
+        size_t i = top_k;
+        for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+            // almost all blocks are rejected by this vectorized check once the heap holds reasonable candidates
+            if (max_value(data + i, BLOCK_SIZE) <= m_candidates.front().m_log_prob) {
+                continue;
+            }
+            for (size_t j = i; j < i + BLOCK_SIZE; ++j) {
+                if (data[j] > m_candidates.front().m_log_prob) {
+                    std::pop_heap(m_candidates.begin(), m_candidates.end(), min_cmp);
+                    m_candidates.back() = Token(data[j], static_cast<int64_t>(j));
+                    std::push_heap(m_candidates.begin(), m_candidates.end(), min_cmp);
+                }
+            }
+        }
+        for (; i < size; ++i) {
+            if (data[i] > m_candidates.front().m_log_prob) {
+                std::pop_heap(m_candidates.begin(), m_candidates.end(), min_cmp);
+                m_candidates.back() = Token(data[i], static_cast<int64_t>(i));
+                std::push_heap(m_candidates.begin(), m_candidates.end(), min_cmp);
+            }
+        }
+    }
+
+    // Computes the softmax weights of the row and optionally the mass of each bin; returns the total weight.
+    float _compute_row_weights(const float* data, size_t size, float max_logit, float inv_temperature, bool fill_histogram) {
+        m_row_weights.resize(size);
+        float total_weight = 0.0f;
+        for (size_t i = 0; i < size; ++i) {
+            m_row_weights[i] = std::exp((data[i] - max_logit) * inv_temperature);
+            total_weight += m_row_weights[i];
+        }
+        if (fill_histogram) {
+            m_bin_mass.fill(0.0f);
+            for (size_t i = 0; i < size; ++i) {
+                m_bin_mass[_bin(data[i], max_logit, inv_temperature)] += m_row_weights[i];
+            }
+        }
+        return total_weight;
+    }
+
+    // Gathers the tokens of all bins up to the first one where the cumulative mass exceeds the threshold.
+    void _gather_nucleus_bins(const float* data, size_t size, float max_logit, float inv_temperature, float threshold) {
+        size_t last_bin = NUM_BINS - 1;
+        float cumulative_mass = 0.0f;
+        for (size_t bin = 0; bin < NUM_BINS; ++bin) {
+            cumulative_mass += m_bin_mass[bin];
+            if (cumulative_mass > threshold) {
+                last_bin = bin;
+                break;
+            }
+        }
+        for (size_t i = 0; i < size; ++i) {
+            if (_bin(data[i], max_logit, inv_temperature) <= last_bin) {
+                m_candidates.emplace_back(data[i], static_cast<int64_t>(i));
+            }
+        }
+    }
+
+    void _sort_candidates() {
+        std::sort(m_candidates.begin(), m_candidates.end(), [](const Token& lhs, const Token& rhs) {
+            return lhs.m_log_prob > rhs.m_log_prob || (lhs.m_log_prob == rhs.m_log_prob && lhs.m_index < rhs.m_index);
+        });
+    }
+
+    void _compute_candidate_weights(float max_logit, float inv_temperature) {
+        m_weights.resize(m_candidates.size());
+        for (size_t i = 0; i < m_candidates.size(); ++i) {
+            m_weights[i] = std::exp((m_candidates[i].m_log_prob - max_logit) * inv_temperature);
+        }
+    }
+
+    void _draw(size_t num_candidates, size_t num_tokens, std::mt19937& rng_engine, std::vector<Token>& out_tokens) {
+        float sum_weight = 0.0f;
+        for (size_t i = 0; i < num_candidates; ++i) {
+            sum_weight += m_weights[i];
+        }
+        // Defensive fallback: if all candidates are masked (-inf / NaN), sample uniformly over them
+        // so generation can continue rather than aborting.
+        if (!(sum_weight > 0.0f && std::isfinite(sum_weight))) {
+            std::uniform_int_distribution<size_t> uniform_idx(0, num_candidates - 1);
+            const float uniform_log_prob = std::log(1.0f / static_cast<float>(num_candidates));
+            for (size_t token_idx = 0; token_idx < num_tokens; ++token_idx) {
+                out_tokens.emplace_back(uniform_log_prob, m_candidates[uniform_idx(rng_engine)].m_index);
+            }
+            return;
+        }
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+        const float log_sum_weight = std::log(sum_weight);
+        for (size_t token_idx = 0; token_idx < num_tokens; ++token_idx) {
+            const float r = sum_weight * u(rng_engine);
+            float cumulative_weight = 0.0f;
+            size_t sampled_idx = num_candidates - 1;  // fallback for floating-point rounding
+            for (size_t i = 0; i < num_candidates; ++i) {
+                cumulative_weight += m_weights[i];
+                if (cumulative_weight > r) {
+                    sampled_idx = i;
+                    break;
+                }
+            }
+            out_tokens.emplace_back(std::log(m_weights[sampled_idx]) - log_sum_weight, m_candidates[sampled_idx].m_index);
+        }
+    }
+
+    void _draw_from_row(const float* data, size_t size, float max_logit, float inv_temperature, float sum_weight,
+                        size_t num_tokens, std::mt19937& rng_engine, std::vector<Token>& out_tokens) {
+        if (!(sum_weight > 0.0f && std::isfinite(sum_weight))) {
+            std::uniform_int_distribution<size_t> uniform_idx(0, size - 1);
+            const float uniform_log_prob = std::log(1.0f / static_cast<float>(size));
+            for (size_t token_idx = 0; token_idx < num_tokens; ++token_idx) {
+                out_tokens.emplace_back(uniform_log_prob, static_cast<int64_t>(uniform_idx(rng_engine)));
+            }
+            return;
+        }
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+        const float log_sum_weight = std::log(sum_weight);
+        for (size_t token_idx = 0; token_idx < num_tokens; ++token_idx) {
+            const float r = sum_weight * u(rng_engine);
+            float cumulative_weight = 0.0f;
+            size_t sampled_idx = size - 1;  // fallback for floating-point rounding
+            for (size_t i = 0; i < size; ++i) {
+                cumulative_weight += m_row_weights[i];
+                if (cumulative_weight > r) {
+                    sampled_idx = i;
+                    break;
+                }
+            }
+            out_tokens.emplace_back((data[sampled_idx] - max_logit) * inv_temperature - log_sum_weight,
+                                    static_cast<int64_t>(sampled_idx));
+        }
+    }
+};
+
+}  // namespace ov::genai
@@ -7,6 +7,7 @@
 #include <cmath>
 
 #include "openvino/genai/generation_config.hpp"
+#include "sampling/fused_sampling.hpp"
 #include "sampling/logit_transformers.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 
@@ -23,6 +24,10 @@ protected:
     // speculative decoding parameters
     float m_assistant_confidence_threshold = 0.f;
 
+    // top_k / temperature / top_p are executed by FusedSamplingKernel in the sampler instead of logit transformers
+    bool m_is_fused_sampling = false;
+    FusedSamplingParams m_fused_sampling_params;
+
 
 public:
     LogitProcessor(const ov::genai::GenerationConfig& sampling_params,
@@ -74,7 +79,14 @@ public:
                 m_logit_transformers.push_back(transformer);
             }
 
-            if (sampling_params.is_multinomial()) {
+            if (sampling_params.is_multinomial() && sampling_params.logprobs == 0) {
+                // Without logprobs nothing needs the filtered m_vector, so the whole top_k -> temperature -> top_p
+                // chain and the draw run as one streaming kernel over m_data (see FusedSamplingKernel).
+                m_is_fused_sampling = true;
+                m_fused_sampling_params.top_k = sampling_params.top_k;
+                m_fused_sampling_params.temperature = sampling_params.temperature;
+                m_fused_sampling_params.top_p = sampling_params.top_p;
+            } else if (sampling_params.is_multinomial()) {
                 // Order: top_k → temperature → top_p
                 //
                 // top_k first: temperature scaling only changes magnitude, we would pick same K tokens
@@ -106,6 +118,14 @@ public:
         }
     }
 
+    bool is_fused_sampling() const {
+        return m_is_fused_sampling;
+    }
+
+    const FusedSamplingParams& get_fused_sampling_params() const {
+        return m_fused_sampling_params;
+    }
+
     float get_assistant_confidence_threshold() {
         return m_assistant_confidence_threshold;
     }
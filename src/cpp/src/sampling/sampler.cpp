@@ -7,47 +7,6 @@
 #include "tokenizer/tokenizer_impl.hpp"
 
 namespace ov::genai {
-// Modified Knuth–Morris–Pratt algorithm which returns tokens following after every needle occurrence in haystack
-std::vector<int64_t> kmp_search(const std::vector<int64_t>& haystack, const std::vector<int64_t>& needle) {
-    if (needle.empty()) {  // no_repeat_ngram_size == 1, ban every token
-        return {haystack.begin(), haystack.end()};
-    }
-    std::vector<int> partial_match_table(needle.size() + 1, -1);
-    int cnd = 0;
-    for (size_t pos = 1; pos < needle.size(); ++pos) {
-        if (needle.at(pos) == needle.at(size_t(cnd))) {
-            partial_match_table.at(pos) = partial_match_table.at(size_t(cnd));
-        } else {
-            partial_match_table.at(pos) = cnd;
-            while (cnd >= 0 && needle.at(pos) != needle.at(size_t(cnd))) {
-                cnd = partial_match_table.at(size_t(cnd));
-            }
-        }
-        ++cnd;
-    }
-    partial_match_table.back() = cnd;
-    std::vector<int64_t> res;
-    size_t haystack_id = 0;
-    int needle_id = 0;
-    while (haystack_id < haystack.size() - 1) {
-        if (needle.at(size_t(needle_id)) == haystack.at(haystack_id)) {
-            ++haystack_id;
-            ++needle_id;
-            if (needle_id == int(needle.size())) {
-                res.push_back(haystack.at(haystack_id));
-                needle_id = partial_match_table.at(size_t(needle_id));
-            }
-        } else {
-            needle_id = partial_match_table.at(size_t(needle_id));
-            if (needle_id < 0) {
-                ++haystack_id;
-                ++needle_id;
-            }
-        }
-    }
-    return res;
-}
-
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     ov::Shape shape = logits.get_shape();
     OPENVINO_ASSERT(shape.size() == 3);
@@ -70,6 +29,64 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     return tokens;
 }
 
+std::vector<Token> log_softmax_top_k(const ov::Tensor& logits, size_t batch_idx, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& adjustments) {
+    ov::Shape shape = logits.get_shape();
+    OPENVINO_ASSERT(shape.size() == 3);
+    size_t batch = shape[0], seq_len = shape[1], vocab_size = shape[2];
+    OPENVINO_ASSERT(batch_idx < batch, "Logits batch size doesn't match the number of beams");
+
+    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
+    const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
+
+    auto greater_log_prob = [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    };
+    // adjusted tokens are scored separately, so the heap keeps enough other tokens to replace them
+    const size_t heap_size = std::min(vocab_size, top_k + adjustments.size());
+    std::vector<Token> heap;  // the smallest of the largest logits is the first
+    heap.reserve(heap_size);
+
+    const float negative_infinity = -std::numeric_limits<float>::infinity();
+    float max_logit = negative_infinity, sum_exp = 0.0f;
+    for (size_t idx = 0; idx < vocab_size; ++idx) {
+        const float logit = beam_logits[idx];
+        // online log-sum-exp: the accumulated sum is rescaled whenever the maximum grows
+        if (logit > max_logit) {
+            sum_exp = sum_exp * std::exp(max_logit - logit) + 1.0f;
+            max_logit = logit;
+        } else if (logit != negative_infinity) {
+            sum_exp += std::exp(logit - max_logit);
+        }
+
+        if (heap.size() < heap_size) {
+            heap.emplace_back(logit, int64_t(idx));
+            std::push_heap(heap.begin(), heap.end(), greater_log_prob);
+        } else if (heap_size > 0 && logit > heap.front().m_log_prob) {
+            std::pop_heap(heap.begin(), heap.end(), greater_log_prob);
+            heap.back() = Token(logit, int64_t(idx));
+            std::push_heap(heap.begin(), heap.end(), greater_log_prob);
+        }
+    }
+    const float log_sum = max_logit + std::log(sum_exp);
+
+    std::vector<Token> tokens;
+    tokens.reserve(heap.size() + adjustments.size());
+    for (const Token& token : heap) {
+        if (!adjustments.count(token.m_index))
+            tokens.emplace_back(token.m_log_prob - log_sum, token.m_index);
+    }
+    for (const auto& [token_id, adjustment] : adjustments) {
+        OPENVINO_ASSERT(token_id >= 0 && size_t(token_id) < vocab_size, "Token id ", token_id, " is out of vocabulary");
+        tokens.emplace_back(beam_logits[token_id] - log_sum + adjustment, token_id);
+    }
+
+    top_k = std::min(top_k, tokens.size());
+    std::partial_sort(tokens.begin(), tokens.begin() + ptrdiff_t(top_k), tokens.end(), greater_log_prob);
+    tokens.resize(top_k);
+    return tokens;
+}
+
 std::vector<int64_t> wrap_tokens(const std::vector<int64_t>& tokens, const std::vector<int64_t>& prefix_tokens, const std::vector<int64_t>& suffix_tokens) {
     std::vector<int64_t> all_tokens = prefix_tokens;
     all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
@@ -153,6 +170,33 @@ MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
     return result;
 }
 
+// Matches `generated_tokens` followed by `extra_token` (if any) with the token-level matcher, falls back to
+// detokenization if there's no matcher or it can't decode the tail of the sequence exactly.
+MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
+                                        StopStringMatcher* matcher,
+                                        uint64_t sequence_id,
+                                        const TokenIds& generated_tokens,
+                                        std::optional<int64_t> extra_token,
+                                        const std::pair<size_t, std::set<std::string>>& stop_strings,
+                                        bool is_include_to_output,
+                                        size_t draft_generated_tokens = 0) {
+    if (matcher != nullptr) {
+        auto matcher_result = matcher->match(sequence_id, generated_tokens, is_include_to_output, extra_token);
+        if (matcher_result.is_reliable) {
+            MatchStopStringResult result;
+            result.is_matched = matcher_result.is_matched;
+            result.to_remove = matcher_result.to_remove;
+            return result;
+        }
+    }
+    if (!extra_token.has_value()) {
+        return match_stop_string(tokenizer, generated_tokens, stop_strings, is_include_to_output, draft_generated_tokens);
+    }
+    TokenIds token_ids = generated_tokens;
+    token_ids.push_back(*extra_token);
+    return match_stop_string(tokenizer, token_ids, stop_strings, is_include_to_output, draft_generated_tokens);
+}
+
 // Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
 // Number of tokens might not be exact as if there's no direct token match, we decode generated tokens incrementally expanding decoding scope
 // with 4 next tokens with each iteration until we check all tokens.
@@ -216,11 +260,26 @@ Sampler::GroupBeamSearcher::GroupBeamSearcher(SequenceGroup::Ptr sequence_group,
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
 
+    const size_t ngram_size = m_parameters.no_repeat_ngram_size;
+    const TokenIds& prompt_ids = m_sequence_group->get_prompt_ids();
+    if (ngram_size > 0 && prompt_ids.size() >= ngram_size) {
+        // all beams start from the same prompt, so its n-grams are indexed once
+        auto prompt_ngrams = std::make_shared<NGramIndex>();
+        for (size_t ngram_end = ngram_size - 1; ngram_end < prompt_ids.size(); ++ngram_end) {
+            TokenIds prefix(prompt_ids.begin() + (ngram_end + 1 - ngram_size), prompt_ids.begin() + ngram_end);
+            prompt_ngrams->m_next_tokens[std::move(prefix)].push_back(prompt_ids[ngram_end]);
+        }
+        prompt_ngrams->m_num_indexed_tokens = prompt_ids.size();
+        m_prompt_ngrams = std::move(prompt_ngrams);
+    }
+
+    Beam base_beam((*sequence_group)[0]);
+
     for (Group& group : m_groups) {
         group.ongoing.reserve(group_size);
         // initially we just add our "base" sequence to beams inside each group
         for (size_t i = 0; i < group_size; ++i)
-            group.ongoing.push_back(Beam((*sequence_group)[0]));
+            group.ongoing.push_back(base_beam);
         // to avoid selecting the same tokens for beams within group, let's just initialize score
         // for the front one
         group.ongoing.front().m_score = 0.0f;
@@ -228,6 +287,52 @@ Sampler::GroupBeamSearcher::GroupBeamSearcher(SequenceGroup::Ptr sequence_group,
 }
 
 
+void Sampler::GroupBeamSearcher::_ban_repeated_ngrams(Beam& beam, std::unordered_map<int64_t, float>& adjustments) const {
+    const size_t ngram_size = m_parameters.no_repeat_ngram_size;
+    const TokenIds& prompt_ids = m_sequence_group->get_prompt_ids();
+    const TokenIds& generated_ids = beam.m_sequence->get_generated_ids();
+    const size_t text_len = prompt_ids.size() + generated_ids.size();
+    if (text_len <= 1 || text_len < ngram_size) {
+        return;
+    }
+    auto token_at = [&](size_t pos) {
+        return pos < prompt_ids.size() ? prompt_ids[pos] : generated_ids[pos - prompt_ids.size()];
+    };
+    auto ngram_prefix = [&](size_t ngram_end) {
+        TokenIds prefix(ngram_size - 1);
+        for (size_t i = 0; i < prefix.size(); ++i)
+            prefix[i] = token_at(ngram_end + 1 - ngram_size + i);
+        return prefix;
+    };
+
+    if (!beam.m_ngrams || beam.m_ngrams->m_num_indexed_tokens > text_len) {
+        // tokens were removed from the text, e.g. matched stop string
+        beam.m_ngrams = std::make_shared<NGramIndex>();
+    } else if (beam.m_ngrams->m_num_indexed_tokens < text_len && beam.m_ngrams.use_count() > 1) {
+        // the text diverged from other children of the same parent, only its generated part is copied
+        beam.m_ngrams = std::make_shared<NGramIndex>(*beam.m_ngrams);
+    }
+    NGramIndex& index = *beam.m_ngrams;
+    for (size_t ngram_end = std::max({index.m_num_indexed_tokens, prompt_ids.size(), ngram_size - 1}); ngram_end < text_len; ++ngram_end) {
+        index.m_next_tokens[ngram_prefix(ngram_end)].push_back(token_at(ngram_end));
+    }
+    index.m_num_indexed_tokens = text_len;
+
+    // the last n - 1 tokens must not be followed by tokens that already followed them
+    const TokenIds prefix = ngram_prefix(text_len);
+    for (const NGramIndex* ngrams : {m_prompt_ngrams.get(), beam.m_ngrams.get()}) {
+        if (!ngrams) {
+            continue;
+        }
+        auto next_tokens = ngrams->m_next_tokens.find(prefix);
+        if (next_tokens != ngrams->m_next_tokens.end()) {
+            for (int64_t banned_token : next_tokens->second) {
+                adjustments[banned_token] = -std::numeric_limits<float>::infinity();
+            }
+        }
+    }
+}
+
 std::map<size_t, int32_t> Sampler::GroupBeamSearcher::get_beam_idxs() {
     std::map<size_t, int32_t> next_beams;
 
@@ -259,7 +364,8 @@ void Sampler::clear_structured_output_compile_times() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    const std::pair<size_t, std::set<std::string>>& stop_strings,
+    StopStringMatcher* stop_string_matcher) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -339,30 +445,23 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
 
         std::vector<Beam> candidates;
         candidates.reserve(group_size * 2 * group_size);
-        for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
+        for (Beam& beam : group.ongoing) {
+            std::unordered_map<int64_t, float> adjustments;
 
             // apply diversity penalty
-            for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
-                for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
-                    tokens[prev_beam.m_token_id].m_log_prob -= m_parameters.diversity_penalty;
+            if (m_parameters.diversity_penalty != 0.0f) {
+                for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
+                    for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
+                        adjustments[prev_beam.m_token_id] -= m_parameters.diversity_penalty;
+                    }
                 }
             }
 
             // apply n_gramm
-            std::vector<int64_t> full_text{m_sequence_group->get_prompt_ids()};
-            full_text.insert(full_text.end(), beam.m_sequence->get_generated_ids().begin(), beam.m_sequence->get_generated_ids().end());
-            if (full_text.size() > 1 && full_text.size() >= m_parameters.no_repeat_ngram_size) {
-                auto tail_start = full_text.end() - ptrdiff_t(m_parameters.no_repeat_ngram_size) + 1;
-                for (int64_t banned_token : kmp_search(full_text, {tail_start, full_text.end()})) {
-                    tokens[banned_token].m_log_prob = -std::numeric_limits<float>::infinity();
-                }
-            }
+            _ban_repeated_ngrams(beam, adjustments);
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
-                return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
-            });
+            // most probable tokens in front
+            std::vector<Token> tokens = log_softmax_top_k(logits, beam.m_global_beam_idx, 2 * group_size, adjustments);
 
             size_t add_count = 0;
             for (Token token : tokens) {
@@ -403,10 +502,9 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
 
             if (!m_parameters.stop_strings.empty()) {
                 // We need to include candidate token to already generated tokens to check if stop string has been generated
-                // There's probably a better way to do that, than copying whole vector...
-                std::vector<int64_t> token_ids = candidate.m_sequence->get_generated_ids();
-                token_ids.push_back(candidate.m_token_id);
-                auto match_result = match_stop_string(m_tokenizer, token_ids, stop_strings, m_parameters.include_stop_str_in_output);
+                auto match_result = match_stop_string(m_tokenizer, stop_string_matcher, candidate.m_sequence->get_id(),
+                                                      candidate.m_sequence->get_generated_ids(), candidate.m_token_id,
+                                                      stop_strings, m_parameters.include_stop_str_in_output);
                 if (match_result.is_matched) {
                     // If beam_token does not belong to top num_beams tokens, it should not be added
                     if (cand_idx >= group_size)
@@ -509,6 +607,10 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     // When logprobs > 0, m_vector is initialized (penalties wrote there, m_data is pristine);
     // scan m_vector so penalty effects influence token selection.
     // Otherwise operate directly on m_data.
+    if (!logits.is_vector_initialized() && top_logprobs == 0) {
+        return Token(0.0f, static_cast<int64_t>(FusedSamplingKernel::argmax(logits.m_data, logits.m_size)));
+    }
+
     size_t m = std::max(size_t(1), top_logprobs); // ensure m is at least 1
     std::vector<float> top_values(m, -std::numeric_limits<float>::infinity());
     std::vector<size_t> top_indexes(m, 0);
@@ -544,6 +646,47 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     return Token(max_value, max_index);
 }
 
+std::vector<Token> Sampler::_greedy_sample_top_k(const Logits& logits, size_t k) const {
+    std::vector<float> top_values(k, -std::numeric_limits<float>::infinity());
+    std::vector<size_t> top_indexes(k, 0);
+
+    const bool use_vector = logits.is_vector_initialized();
+    auto value_at = [&](size_t i) { return use_vector ? logits.m_vector[i].m_log_prob : logits.m_data[i]; };
+    auto index_at = [&](size_t i) -> size_t { return use_vector ? static_cast<size_t>(logits.m_vector[i].m_index) : i; };
+
+    size_t num_candidates = 0;
+    for (size_t i = 0; i < logits.m_size; ++i) {
+        if (value_at(i) > top_values.back()) {
+            top_values.back() = value_at(i);
+            top_indexes.back() = index_at(i);
+            num_candidates = std::min(num_candidates + 1, k);
+
+            for (size_t j = top_values.size() - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
+                std::swap(top_values[j], top_values[j - 1]);
+                std::swap(top_indexes[j], top_indexes[j - 1]);
+            }
+        }
+    }
+
+    // the first token is returned even if all logits are masked out, as `_greedy_sample` does
+    num_candidates = std::max(num_candidates, size_t(1));
+    std::vector<Token> top_tokens;
+    top_tokens.reserve(num_candidates);
+    for (size_t i = 0; i < num_candidates; ++i) {
+        top_tokens.emplace_back(0.0f, static_cast<int64_t>(top_indexes[i]));
+    }
+    return top_tokens;
+}
+
+std::vector<Token> Sampler::_fused_multinomial_sample(const Logits& logits, const FusedSamplingParams& params, size_t num_tokens_per_sequence) {
+    // sequence groups may be sampled on several threads; each keeps its own scratch buffers
+    thread_local FusedSamplingKernel kernel;
+    std::vector<Token> out_tokens;
+    out_tokens.reserve(num_tokens_per_sequence);
+    kernel.sample(logits.m_data, logits.m_size, params, num_tokens_per_sequence, rng_engine, out_tokens);
+    return out_tokens;
+}
+
 std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
     std::uniform_real_distribution<float> u(0.0f, 1.0f);
     std::vector<Token> out_tokens;
@@ -664,6 +807,7 @@ std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num
 
 std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequence_group) {
     const auto& sampling_params = sequence_group->get_sampling_parameters();
+    StopStringMatcher* stop_string_matcher = _find_stop_string_matcher(sequence_group->get_request_id());
     std::vector<int64_t> dropped_seq_ids;
     for (auto& running_sequence : sequence_group->get_running_sequences()) {
         const auto generated_len = running_sequence->get_generated_len();
@@ -684,7 +828,8 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
 
         if (!sampling_params.stop_strings.empty()) {
             auto& stop_strings = m_stop_strings.at(sequence_group->get_request_id());
-            auto match_result = match_stop_string(m_tokenizer, running_sequence->get_generated_ids(), stop_strings,
+            auto match_result = match_stop_string(m_tokenizer, stop_string_matcher, running_sequence->get_id(),
+                                                  running_sequence->get_generated_ids(), std::nullopt, stop_strings,
                                                   sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
             if (match_result.is_matched) {
                 running_sequence->remove_last_tokens(match_result.to_remove);
@@ -695,6 +840,13 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
             }
         }
     }
+    if (stop_string_matcher != nullptr) {
+        std::vector<uint64_t> running_seq_ids;
+        for (const auto& running_sequence : sequence_group->get_running_sequences()) {
+            running_seq_ids.push_back(running_sequence->get_id());
+        }
+        stop_string_matcher->retain(running_seq_ids);
+    }
     return dropped_seq_ids;
 }
 
@@ -749,6 +901,29 @@ create_n_forked_sequences(SequenceGroup::Ptr sequence_group,
     return forked_seq_ids;
 }
 
+// Keeps the candidate branch of tree speculative decoding with the longest accepted part, the others are dropped.
+// Branches differ starting from their first candidate, so the kept one contains all tokens accepted in any of them.
+void
+keep_longest_branch(SequenceGroup::Ptr sequence_group,
+                    const std::vector<Sequence::Ptr>& branches,
+                    SequenceGroupSamplingInfo& sg_sampling_info) {
+    // the first of equally long branches is kept, so that the original sequence survives if nothing is accepted
+    auto longest_branch = std::max_element(branches.begin(), branches.end(), [](const Sequence::Ptr& lhs, const Sequence::Ptr& rhs) {
+        return lhs->get_generated_len() < rhs->get_generated_len();
+    });
+    for (const auto& branch : branches) {
+        if (branch == *longest_branch) {
+            continue;
+        }
+        // finished branches are already dropped
+        if (!branch->has_finished()) {
+            sg_sampling_info.sampler_output.m_dropped_sequences.push_back(branch->get_id());
+        }
+        sequence_group->remove_sequence(branch->get_id());
+    }
+    sg_sampling_info.get_assisting_pipeline_info().min_generated_len = (*longest_branch)->get_generated_len();
+}
+
 void
 stop_sample_tokens(Sequence::Ptr running_sequence,
                    size_t token_idx,
@@ -885,8 +1060,10 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
     if (sampling_params.is_greedy_decoding() || sampling_params.is_multinomial()) {
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
         size_t num_running_sequences = sequence_group->num_running_seqs();
+        // several sequences of a greedy request are candidate branches of tree speculative decoding
+        const bool is_branched_assisting = sampling_params.num_assistant_branches > 1;
         if (sampling_params.is_greedy_decoding()) {
-            OPENVINO_ASSERT(num_running_sequences == 1);
+            OPENVINO_ASSERT(num_running_sequences == 1 || is_branched_assisting);
         }
         for (size_t running_sequence_id = 0; running_sequence_id < num_running_sequences; ++running_sequence_id) {
             auto& running_sequence = running_sequences[running_sequence_id];
@@ -919,14 +1096,25 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 logit_processor.apply(logit_vector);
                 Token sampled_token;
                 bool is_generate_n_tokens = false;
-                if (sampling_params.is_greedy_decoding()) {
+                if (sampling_params.is_greedy_decoding() && !is_validation_mode_enabled && is_branched_assisting && num_running_sequences == 1) {
+                    // draft model starts candidate branches with its top tokens, the main model validates all of them
+                    std::vector<Token> top_tokens = _greedy_sample_top_k(logit_vector, sampling_params.num_assistant_branches);
+                    for (size_t branch_id = 1; branch_id < top_tokens.size(); ++branch_id) {
+                        const auto branch = sequence_group->fork_sequence(running_sequence);
+                        register_new_token(top_tokens[branch_id], branch, logit_processor, true, is_validation_mode_enabled);
+                        sg_sampling_info.sampler_output.m_forked_sequences[running_sequence->get_id()].push_back(branch->get_id());
+                    }
+                    sampled_token = top_tokens.front();
+                } else if (sampling_params.is_greedy_decoding()) {
                     sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
                 } else {
                     // is_multinomial()
                     is_generate_n_tokens = sequence_group->num_total_seqs() == 1;
                     const size_t num_tokens_per_sequence = is_generate_n_tokens ? sampling_params.num_return_sequences : 1;
                     is_generate_n_tokens &= (num_tokens_per_sequence > 1);
-                    auto sampled_token_ids = _multinomial_sample(logit_vector, num_tokens_per_sequence);
+                    auto sampled_token_ids = logit_processor.is_fused_sampling()
+                        ? _fused_multinomial_sample(logit_vector, logit_processor.get_fused_sampling_params(), num_tokens_per_sequence)
+                        : _multinomial_sample(logit_vector, num_tokens_per_sequence);
                     OPENVINO_ASSERT(sampled_token_ids.size(), num_tokens_per_sequence);
                     // to create n sequence just in case of `sequence_group->num_total_seqs() == 1` and `sampling_params.num_return_sequences > 1`
                     if (is_generate_n_tokens) {
@@ -984,6 +1172,9 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
             }
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
         }
+        if (is_validation_mode_enabled && is_branched_assisting && num_running_sequences > 1) {
+            keep_longest_branch(sequence_group, running_sequences, sg_sampling_info);
+        }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
         for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
@@ -1006,7 +1197,16 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         }
 
         // current algorithm already adds new tokens to running sequences and
-        beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_strings);
+        StopStringMatcher* stop_string_matcher = _find_stop_string_matcher(request_id);
+        beam_searcher->select_next_tokens(sequence_group_logits, sg_sampling_info.sampler_output, stop_strings, stop_string_matcher);
+        if (stop_string_matcher != nullptr) {
+            // forget the beams which were dropped or replaced by their children
+            std::vector<uint64_t> running_seq_ids;
+            for (const auto& running_sequence : sequence_group->get_running_sequences()) {
+                running_seq_ids.push_back(running_sequence->get_id());
+            }
+            stop_string_matcher->retain(running_seq_ids);
+        }
 
         // check max length stop criteria
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
@@ -1033,6 +1233,15 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
 
     SamplerOutput sampler_output;
     std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
+    // greedy / multinomial groups sampled together in batched mode, in the order of their logits
+    struct BatchedSamplingItem {
+        SequenceGroup::Ptr sequence_group;
+        ov::Tensor logits;
+        LogitProcessor* logit_processor;
+        const std::pair<size_t, std::set<std::string>>* stop_strings;
+    };
+    std::vector<BatchedSamplingItem> batched_items;
+    std::unordered_map<uint64_t, size_t> batched_item_ids;
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -1040,31 +1249,21 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
 
         const size_t num_running_sequences = sequence_group->num_running_seqs();
         const size_t output_seq_len = sequence_group->get_output_seq_len();
-        const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
 
         const auto request_id = sequence_group->get_request_id();
-        if (!m_logit_processors.count(request_id)) {
-            std::shared_ptr<StructuredOutputController> structured_output_controller = nullptr;
-            if (m_tokenizer.m_pimpl != nullptr) {
-                structured_output_controller = m_tokenizer.m_pimpl->get_structured_output_controller(vocab_size);
-            }
-            m_logit_processors.insert({request_id, LogitProcessor(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller)});
-        }
-        if (!m_stop_strings.count(request_id)) {
-            if (!sampling_params.stop_strings.empty()) {
-                OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
-                auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
-                m_stop_strings.insert({static_cast<int64_t>(request_id), processed_stop_string});
-                sequence_group->set_stream_window_size(processed_stop_string.first);
-            } else {
-                m_stop_strings.insert({static_cast<int64_t>(request_id), {size_t(0), {}}});
-            }
-        }
+        _prepare_request_info(sequence_group, vocab_size);
         const auto& stop_strings = m_stop_strings.at(request_id);
         auto& logit_processor = m_logit_processors.at(request_id);
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
-        if (sequence_group->requires_sampling()) {
+        const auto& sampling_params = sequence_group->get_sampling_parameters();
+        const bool is_batched = m_is_batched_sampling &&
+                                (sampling_params.is_greedy_decoding() || sampling_params.is_multinomial()) &&
+                                !sampling_params.is_structured_output_generation();
+        if (sequence_group->requires_sampling() && is_batched) {
+            batched_item_ids[request_id] = batched_items.size();
+            batched_items.push_back({sequence_group, sequence_group_logits, &logit_processor, &stop_strings});
+        } else if (sequence_group->requires_sampling()) {
             // Call sample_from_sequence_group asynchronously
             sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
                                                                       logit_processor, stop_strings, is_validation_mode_enabled);
@@ -1075,15 +1274,28 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         currently_processed_tokens += output_seq_len * num_running_sequences;
     }
 
+    // Contiguous runs of cheap groups are spread over the pool at once instead of one task per group
+    std::vector<SequenceGroupSamplingInfo> batched_sampling_infos(batched_items.size());
+    m_thread_pool.parallel_for(batched_items.size(), [&](size_t begin, size_t end) {
+        for (size_t item_id = begin; item_id < end; ++item_id) {
+            const auto& item = batched_items[item_id];
+            batched_sampling_infos[item_id] = sample_from_sequence_group(item.sequence_group, item.logits, *item.logit_processor,
+                                                                         *item.stop_strings, is_validation_mode_enabled);
+        }
+    }, m_batched_sampling_chunk_size);
+
     // Update sequence groups internal states after sampling is done
     for (auto& sequence_group : sequence_groups) {
         if (!sequence_group->is_scheduled())
             continue;
         SequenceGroupSamplingInfo sg_sampling_info;
         const auto request_id = sequence_group->get_request_id();
-        if (sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end()) {
+        const bool is_future_sampled = sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end();
+        const bool is_batch_sampled = batched_item_ids.find(request_id) != batched_item_ids.end();
+        if (is_future_sampled || is_batch_sampled) {
             // If there is a future assigned to a sequence group we read it's result (blocking if results not available yet)
-            sg_sampling_info = sg_sampling_future_map[request_id].get();
+            sg_sampling_info = is_future_sampled ? sg_sampling_future_map[request_id].get()
+                                                 : std::move(batched_sampling_infos[batched_item_ids[request_id]]);
             sampler_output.num_generated_tokens += sg_sampling_info.sampler_output.num_generated_tokens;
 
             // Merge sampler output from sequence group to the main one
@@ -1119,6 +1331,46 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
     return sampler_output;
 }
 
+void Sampler::_prepare_request_info(SequenceGroup::Ptr sequence_group, size_t vocab_size) {
+    const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+    const auto request_id = sequence_group->get_request_id();
+    if (!m_logit_processors.count(request_id)) {
+        std::shared_ptr<StructuredOutputController> structured_output_controller = nullptr;
+        if (m_tokenizer.m_pimpl != nullptr) {
+            structured_output_controller = m_tokenizer.m_pimpl->get_structured_output_controller(vocab_size);
+        }
+        m_logit_processors.insert({request_id, LogitProcessor(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller)});
+    }
+    if (!m_stop_strings.count(request_id)) {
+        if (!sampling_params.stop_strings.empty()) {
+            OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
+            auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
+            m_stop_strings.insert({static_cast<int64_t>(request_id), processed_stop_string});
+            sequence_group->set_stream_window_size(processed_stop_string.first);
+            // while the decoded vocabulary is built in background, stop strings are matched by decoding the generated tokens
+            auto decoded_vocab = m_tokenizer.m_pimpl->get_decoded_vocab_if_ready();
+            if (decoded_vocab && !decoded_vocab->empty()) {
+                m_stop_string_matchers.emplace(request_id, StopStringMatcher(sampling_params.stop_strings, decoded_vocab, processed_stop_string.first));
+            }
+        } else {
+            m_stop_strings.insert({static_cast<int64_t>(request_id), {size_t(0), {}}});
+        }
+    }
+}
+
+StopStringMatcher* Sampler::_find_stop_string_matcher(uint64_t request_id) {
+    auto it = m_stop_string_matchers.find(request_id);
+    return it != m_stop_string_matchers.end() ? &it->second : nullptr;
+}
+
+void Sampler::prepare(const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t vocab_size) {
+    for (const auto& sequence_group : sequence_groups) {
+        if (sequence_group->is_scheduled()) {
+            _prepare_request_info(sequence_group, vocab_size);
+        }
+    }
+}
+
 LogitProcessor& Sampler::get_logit_processor(uint64_t request_id) {
     OPENVINO_ASSERT(m_logit_processors.count(request_id));
     return m_logit_processors.at(request_id);
@@ -1137,10 +1389,13 @@ void Sampler::clear_request_info(uint64_t request_id) {
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
     m_stop_strings.erase(request_id);
+    m_stop_string_matchers.erase(request_id);
 }
 
 int64_t Sampler::GroupBeamSearcher::Group::finish(Beam beam, const ov::genai::GenerationConfig& sampling_params) {
     int64_t preeempted_sequence_id = -1;
+    // finished beams are not extended
+    beam.m_ngrams.reset();
     float generated_len = beam.get_generated_len() + (is_stop_token_id_hit(beam.m_token_id, sampling_params.stop_token_ids) ? 1 : 0); // HF counts EOS token in generation length
     beam.m_score /= std::pow(generated_len, sampling_params.length_penalty);
 
@@ -13,6 +13,7 @@
 #include <cmath>
 #include <random>
 #include <set>
+#include <unordered_map>
 
 #include "openvino/runtime/tensor.hpp"
 
@@ -22,6 +23,7 @@
 #include "sequence_group.hpp"
 #include "threadpool.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
+#include "sampling/stop_string_matcher.hpp"
 
 namespace ov::genai {
 // Handle stop_token_ids
@@ -45,6 +47,15 @@ inline bool is_stop_token_id_hit_in_sequence_group(SequenceGroup::Ptr sequence_g
 
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx);
 
+/**
+ * Selects `top_k` most probable tokens of the last position of `batch_idx` logits and computes their log probabilities.
+ * Log-sum-exp is accumulated in the same single pass over the vocabulary, so no vocabulary sized buffer is allocated.
+ * @param adjustments are added to log probabilities of the given tokens before selection: penalties or -inf to ban a token.
+ * @return Tokens sorted by adjusted log probabilities, most probable in front.
+ */
+std::vector<Token> log_softmax_top_k(const ov::Tensor& logits, size_t batch_idx, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& adjustments = {});
+
 struct SamplerOutput {
     // IDs of sequences that need to be dropped
     std::vector<uint64_t> m_dropped_sequences;
@@ -75,8 +86,13 @@ class Sampler {
 
     Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
+    // `k` tokens with the highest logits in descending order (fewer if there are not enough unmasked ones)
+    std::vector<Token> _greedy_sample_top_k(const Logits& logits, size_t k) const;
     std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
+    std::vector<Token> _fused_multinomial_sample(const Logits& logits, const FusedSamplingParams& params, size_t num_tokens_per_sequence);
     std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
+    void _prepare_request_info(SequenceGroup::Ptr sequence_group, size_t vocab_size);
+    StopStringMatcher* _find_stop_string_matcher(uint64_t request_id);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample, bool has_real_probolities);
@@ -95,10 +111,16 @@ class Sampler {
     std::map<uint64_t, LogitProcessor> m_logit_processors;
     // { request_id, { max_encoded_len, { stop_strings }}}
     std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // { request_id, stop string matcher }, absent if the tokenizer vocabulary can't be decoded token by token
+    std::map<uint64_t, StopStringMatcher> m_stop_string_matchers;
 
     Tokenizer m_tokenizer;
 
     ThreadPool m_thread_pool;
+    // sample greedy / multinomial groups with one parallel_for over the batch instead of a task per group
+    bool m_is_batched_sampling = false;
+    // number of consecutive sequence groups a pool thread takes at once in batched mode
+    size_t m_batched_sampling_chunk_size = 8;
     std::shared_ptr<ov::op::v0::Constant> m_d2t_mapping; // Tensor to store draft_id_to_target_id mapping for eagle model, adding offsets to draft tokens after sampling
 public:
     Sampler(const Sampler& rhs) = delete;
@@ -107,12 +129,22 @@ public:
     explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
 
     SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
+    /**
+     * Creates per-request sampling state (logit processors, structured output matchers, encoded stop strings)
+     * for scheduled sequence groups which do not have it yet. Does not depend on logits, so it can be called
+     * while the model is being inferred; otherwise the same work is done lazily by `sample`.
+     */
+    void prepare(const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t vocab_size);
     void set_seed(size_t new_seed) {
         rng_engine.seed(new_seed);
         seed = new_seed;
     }
     size_t get_seed() { return seed; }
 
+    void set_batched_sampling(bool is_batched_sampling) {
+        m_is_batched_sampling = is_batched_sampling;
+    }
+
     void set_tokenizer(const Tokenizer& tokenizer) {
         m_tokenizer = tokenizer;
     }
@@ -133,9 +165,30 @@ public:
 };
 
 class Sampler::GroupBeamSearcher {
+    // Index of n-grams of the text for `no_repeat_ngram_size`: n-grams of the prompt are indexed once for all beams,
+    // n-grams ending in generated tokens are indexed per beam incrementally
+    struct NGramIndex {
+        struct Hash {
+            size_t operator()(const TokenIds& tokens) const {
+                size_t seed = tokens.size();
+                for (int64_t token : tokens) {
+                    seed ^= std::hash<int64_t>{}(token) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+                }
+                return seed;
+            }
+        };
+
+        // first n - 1 tokens of every n-gram => tokens which followed them
+        std::unordered_map<TokenIds, TokenIds, Hash> m_next_tokens;
+        // n-grams ending before this position of the text are indexed
+        size_t m_num_indexed_tokens = 0;
+    };
+
     struct Beam {
         Sequence::Ptr m_sequence;
         size_t m_global_beam_idx = 0;
+        // n-grams ending in generated tokens, shared by beams forked from the same parent, copied on write
+        std::shared_ptr<NGramIndex> m_ngrams;
 
         // beam is made on top of sequence
         float m_log_prob = 0.0f;
@@ -169,10 +222,16 @@ class Sampler::GroupBeamSearcher {
     ov::genai::GenerationConfig m_parameters;
     std::vector<Group> m_groups;
     Tokenizer m_tokenizer;
+    // n-grams which end in the prompt
+    std::shared_ptr<const NGramIndex> m_prompt_ngrams;
+
+    // indexes n-grams appended to the beam's text since the previous call and bans tokens which would repeat an n-gram
+    void _ban_repeated_ngrams(Beam& beam, std::unordered_map<int64_t, float>& adjustments) const;
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings,
+                            StopStringMatcher* stop_string_matcher = nullptr);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
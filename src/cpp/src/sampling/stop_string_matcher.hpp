@@ -0,0 +1,242 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Detects stop strings in generated text without detokenizer calls.
+ *
+ * The stop strings of a request are compiled into an Aho-Corasick automaton over bytes. Generated tokens are mapped
+ * to their text with a vocabulary decoded once per tokenizer (see Tokenizer::TokenizerImpl::get_decoded_vocab) and fed
+ * into the automaton incrementally: per sequence the matcher keeps the text and the automaton state after each token,
+ * so a step costs O(bytes of the new tokens). When generated tokens are rolled back (speculative decoding), the state
+ * is truncated to the common prefix.
+ *
+ * Some tokens cannot be mapped to text exactly (e.g. byte fallback tokens holding a part of a UTF-8 character). If
+ * such a token is among the tokens a stop string could span, `match` reports that the result is not reliable and the
+ * caller falls back to detokenizer-based matching.
+ */
+class StopStringMatcher {
+public:
+    // decoded text of each token id, std::nullopt for tokens which can't be decoded in isolation
+    using DecodedVocab = std::vector<std::optional<std::string>>;
+
+    struct Result {
+        bool is_reliable = true;
+        bool is_matched = false;
+        // number of trailing tokens to remove from the sequence
+        size_t to_remove = 0;
+    };
+
+    /**
+     * @param stop_strings Non-empty stop strings of the request.
+     * @param decoded_vocab Decoded vocabulary of the tokenizer.
+     * @param max_stop_string_tokens The maximum number of tokens a stop string is encoded into; limits how far back
+     * a token which can't be decoded in isolation makes the result unreliable.
+     */
+    StopStringMatcher(const std::set<std::string>& stop_strings,
+                      std::shared_ptr<const DecodedVocab> decoded_vocab,
+                      size_t max_stop_string_tokens) :
+            m_decoded_vocab(std::move(decoded_vocab)), m_max_stop_string_tokens(max_stop_string_tokens) {
+        OPENVINO_ASSERT(m_decoded_vocab != nullptr, "Decoded vocabulary is required for stop string matching");
+        _build_automaton(stop_strings);
+    }
+
+    /**
+     * Checks whether `generated_ids` (followed by `extra_token`, if given, which is not remembered) contain a stop
+     * string ending in the tokens added since the previous call for this sequence.
+     * @param include_to_output Whether the stop string is kept in the output; determines the number of tokens to remove.
+     */
+    Result match(uint64_t sequence_id, const std::vector<int64_t>& generated_ids, bool include_to_output,
+                 std::optional<int64_t> extra_token = std::nullopt) {
+        SequenceState& state = m_sequences[sequence_id];
+        const size_t checked_len = _sync(state, generated_ids);
+        if (extra_token.has_value()) {
+            _append(state, *extra_token);
+        }
+
+        Result result;
+        const size_t num_tokens = state.tokens.size();
+        const size_t window_begin = num_tokens > m_max_stop_string_tokens + (num_tokens - checked_len) ?
+                                    num_tokens - m_max_stop_string_tokens - (num_tokens - checked_len) : 0;
+        result.is_reliable = state.last_inexact_token == NO_TOKEN || state.last_inexact_token < window_begin;
+        if (result.is_reliable) {
+            // scan the bytes of the new tokens starting from the automaton state after the last checked token
+            int32_t node = checked_len > 0 ? state.nodes[checked_len - 1] : 0;
+            const size_t begin = checked_len > 0 ? state.text_ends[checked_len - 1] : 0;
+            for (size_t pos = begin; pos < state.text.size(); ++pos) {
+                node = m_transitions[node][static_cast<uint8_t>(state.text[pos])];
+                if (m_match_lengths[node] > 0) {
+                    result.is_matched = true;
+                    const size_t match_end = pos + 1;
+                    result.to_remove = _num_tokens_to_remove(state, include_to_output ? match_end : match_end - m_match_lengths[node]);
+                    break;
+                }
+            }
+        }
+        if (extra_token.has_value()) {
+            _truncate(state, num_tokens - 1);
+        }
+        return result;
+    }
+
+    /**
+     * Forgets the state of the sequences which are not in `sequence_ids`.
+     */
+    void retain(const std::vector<uint64_t>& sequence_ids) {
+        for (auto it = m_sequences.begin(); it != m_sequences.end();) {
+            if (std::find(sequence_ids.begin(), sequence_ids.end(), it->first) == sequence_ids.end()) {
+                it = m_sequences.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+private:
+    static constexpr size_t NO_TOKEN = std::numeric_limits<size_t>::max();
+
+    struct SequenceState {
+        std::vector<int64_t> tokens;
+        std::string text;
+        // per token: end of its text and the automaton node after its last byte
+        std::vector<size_t> text_ends;
+        std::vector<int32_t> nodes;
+        size_t last_inexact_token = NO_TOKEN;
+    };
+
+    std::shared_ptr<const DecodedVocab> m_decoded_vocab;
+    size_t m_max_stop_string_tokens;
+    // dense goto function of the automaton, failure transitions already resolved
+    std::vector<std::array<int32_t, 256>> m_transitions;
+    // the length of the longest stop string ending at each node, 0 if none
+    std::vector<size_t> m_match_lengths;
+    std::unordered_map<uint64_t, SequenceState> m_sequences;
+
+    void _build_automaton(const std::set<std::string>& stop_strings) {
+        std::array<int32_t, 256> empty;
+        empty.fill(-1);
+        m_transitions.push_back(empty);
+        m_match_lengths.push_back(0);
+        for (const auto& stop_string : stop_strings) {
+            if (stop_string.empty()) {
+                continue;
+            }
+            int32_t node = 0;
+            for (char c : stop_string) {
+                auto& next = m_transitions[node][static_cast<uint8_t>(c)];
+                if (next == -1) {
+                    next = static_cast<int32_t>(m_transitions.size());
+                    m_transitions.push_back(empty);
+                    m_match_lengths.push_back(0);
+                }
+                node = m_transitions[node][static_cast<uint8_t>(c)];
+            }
+            m_match_lengths[node] = std::max(m_match_lengths[node], stop_string.size());
+        }
+
+        // breadth-first: resolve missing transitions through failure links and inherit matches of the failure node
+        std::vector<int32_t> failure(m_transitions.size(), 0);
+        std::queue<int32_t> queue;
+        for (auto& next : m_transitions[0]) {
+            if (next == -1) {
+                next = 0;
+            } else {
+                queue.push(next);
+            }
+        }
+        while (!queue.empty()) {
+            int32_t node = queue.front();
+            queue.pop();
+            m_match_lengths[node] = std::max(m_match_lengths[node], m_match_lengths[failure[node]]);
+            for (size_t byte = 0; byte < 256; ++byte) {
+                int32_t& next = m_transitions[node][byte];
+                if (next == -1) {
+                    next = m_transitions[failure[node]][byte];
+                } else {
+                    failure[next] = m_transitions[failure[node]][byte];
+                    queue.push(next);
+                }
+            }
+        }
+    }
+
+    void _append(SequenceState& state, int64_t token) {
+        const auto& decoded_vocab = *m_decoded_vocab;
+        const bool is_exact = token >= 0 && static_cast<size_t>(token) < decoded_vocab.size() && decoded_vocab[token].has_value();
+        if (is_exact) {
+            state.text += *decoded_vocab[token];
+        } else if (state.last_inexact_token == NO_TOKEN || state.last_inexact_token < state.tokens.size()) {
+            state.last_inexact_token = state.tokens.size();
+        }
+        int32_t node = state.nodes.empty() ? 0 : state.nodes.back();
+        const size_t begin = state.text_ends.empty() ? 0 : state.text_ends.back();
+        for (size_t pos = begin; pos < state.text.size(); ++pos) {
+            node = m_transitions[node][static_cast<uint8_t>(state.text[pos])];
+        }
+        state.tokens.push_back(token);
+        state.text_ends.push_back(state.text.size());
+        state.nodes.push_back(node);
+    }
+
+    void _truncate(SequenceState& state, size_t new_size) {
+        state.tokens.resize(new_size);
+        state.text_ends.resize(new_size);
+        state.nodes.resize(new_size);
+        state.text.resize(new_size > 0 ? state.text_ends.back() : 0);
+        if (state.last_inexact_token != NO_TOKEN && state.last_inexact_token >= new_size) {
+            state.last_inexact_token = NO_TOKEN;
+            const auto& decoded_vocab = *m_decoded_vocab;
+            for (size_t i = new_size; i > 0; --i) {
+                const int64_t token = state.tokens[i - 1];
+                if (token < 0 || static_cast<size_t>(token) >= decoded_vocab.size() || !decoded_vocab[token].has_value()) {
+                    state.last_inexact_token = i - 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Brings the state in sync with the generated tokens; returns the number of tokens which were already checked.
+    size_t _sync(SequenceState& state, const std::vector<int64_t>& generated_ids) {
+        // the tail may be replaced by tokens ending with the same one (e.g. after candidate validation), so the whole
+        // prefix is compared; it's a plain memory comparison, much cheaper than processing the text again
+        const size_t num_compared = std::min(state.tokens.size(), generated_ids.size());
+        const size_t common = std::mismatch(state.tokens.begin(), state.tokens.begin() + num_compared, generated_ids.begin()).first -
+                              state.tokens.begin();
+        _truncate(state, common);
+        for (size_t i = common; i < generated_ids.size(); ++i) {
+            _append(state, generated_ids[i]);
+        }
+        return common;
+    }
+
+    // The minimal number of leading tokens whose text covers the text before `cut` (without trailing spaces and new
+    // lines) is kept, the rest is removed.
+    static size_t _num_tokens_to_remove(const SequenceState& state, size_t cut) {
+        while (cut > 0 && (state.text[cut - 1] == ' ' || state.text[cut - 1] == '\n')) {
+            --cut;
+        }
+        const size_t num_kept = cut == 0 ? 0 :
+            std::lower_bound(state.text_ends.begin(), state.text_ends.end(), cut) - state.text_ends.begin() + 1;
+        return state.tokens.size() - num_kept;
+    }
+};
+
+}  // namespace ov::genai
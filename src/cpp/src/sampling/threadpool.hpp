@@ -4,6 +4,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -12,6 +13,9 @@
 #include <thread>
 #include <utility>
 #include <atomic>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 class ThreadPool {
 
@@ -75,4 +79,67 @@ public:
         cv.notify_one();
         return result;
     }
+
+    /**
+     * Runs `body(begin, end)` over [0, num_items) split into chunks of `chunk_size` items and blocks until all of them
+     * are processed. Every participant (the pool threads and the calling thread) owns a contiguous range and takes
+     * chunks from its front; once its range is exhausted, it steals chunks from the ranges of the others. Dispatch
+     * costs one task per pool thread regardless of the number of items.
+     */
+    template <typename F>
+    void parallel_for(size_t num_items, F&& body, size_t chunk_size = 1)
+    {
+        chunk_size = std::max<size_t>(chunk_size, 1);
+        const size_t num_participants = std::min(threads.size() + 1, (num_items + chunk_size - 1) / chunk_size);
+        if (num_participants <= 1) {
+            if (num_items > 0) {
+                body(size_t(0), num_items);
+            }
+            return;
+        }
+
+        struct Range {
+            std::atomic<size_t> next{0};
+            size_t end = 0;
+        };
+        std::unique_ptr<Range[]> ranges(new Range[num_participants]);
+        for (size_t participant = 0; participant < num_participants; ++participant) {
+            ranges[participant].next = num_items * participant / num_participants;
+            ranges[participant].end = num_items * (participant + 1) / num_participants;
+        }
+        auto run = [&ranges, &body, num_participants, chunk_size](size_t participant) {
+            for (size_t i = 0; i < num_participants; ++i) {
+                Range& range = ranges[(participant + i) % num_participants];
+                size_t begin;
+                while ((begin = range.next.fetch_add(chunk_size)) < range.end) {
+                    body(begin, std::min(begin + chunk_size, range.end));
+                }
+            }
+        };
+
+        std::vector<std::future<void>> helpers;
+        helpers.reserve(num_participants - 1);
+        for (size_t participant = 1; participant < num_participants; ++participant) {
+            helpers.push_back(submit(run, participant));
+        }
+        std::exception_ptr error;
+        try {
+            run(0);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // helpers refer to the ranges on this stack frame, so all of them are joined before any error is rethrown
+        for (auto& helper : helpers) {
+            try {
+                helper.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
 };
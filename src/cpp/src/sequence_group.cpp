@@ -1,8 +1,8 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#include <string_view>
 #include "sequence_group.hpp"
+#include "utils.hpp"
 
 namespace ov {
 namespace genai {
@@ -63,9 +63,8 @@ size_t Sequence::_make_hash(size_t content_length) {
         else {
             OPENVINO_THROW("Hash calculation is not supported for this sequence type.");
         }
-        const char* data = reinterpret_cast<const char*>(content.data());
-        std::size_t size = content.size() * sizeof(content[0]);
-        return std::hash<std::string_view>{}(std::string_view(data, size));
+        // stable across processes and platforms, so hashes can be used as keys for persisted KV blocks
+        return static_cast<size_t>(utils::stable_hash(content.data(), content.size() * sizeof(content[0]), sequence_group->get_hash_seed()));
 }
 
 std::vector<int64_t> Sequence::_reduce_embedding(const std::vector<float>& embedding) {
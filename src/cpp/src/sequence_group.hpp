@@ -351,6 +351,9 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // seed of KV block hashes, binds prefix cache keys to the model which computes KV cache
+    uint64_t m_hash_seed = 0;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
@@ -777,12 +780,31 @@ public:
         return m_block_size;
     }
 
+    void set_hash_seed(uint64_t hash_seed) {
+        m_hash_seed = hash_seed;
+    }
+
+    uint64_t get_hash_seed() const {
+        return m_hash_seed;
+    }
+
     Sequence::Ptr fork_sequence(Sequence::CPtr sequence) {
         auto forked_sequence = Sequence::fork(sequence, m_next_sequence_id++);
         m_sequences.emplace_back(forked_sequence);
         return forked_sequence;
     }
 
+    // forks a sequence with a given grouped id, e.g. to mirror a branch of another pipeline's sequence group
+    Sequence::Ptr fork_sequence(Sequence::CPtr sequence, uint64_t grouped_id) {
+        for (const auto& existing_sequence : m_sequences) {
+            OPENVINO_ASSERT(existing_sequence->get_grouped_id() != grouped_id, "Sequence with grouped id ", grouped_id, " already exists");
+        }
+        auto forked_sequence = Sequence::fork(sequence, grouped_id);
+        m_next_sequence_id = std::max(m_next_sequence_id, grouped_id + 1);
+        m_sequences.emplace_back(forked_sequence);
+        return forked_sequence;
+    }
+
     const ov::genai::GenerationConfig& get_sampling_parameters() const {
         return m_sampling_params;
     }
@@ -0,0 +1,133 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace ov::genai {
+
+/**
+ * @brief Chooses the number of draft tokens per speculative decoding iteration for each request.
+ *
+ * Keeps moving averages of the request's number of accepted draft tokens and of rejections per iteration, as well as of
+ * the draft / main model latencies of one inference. Draft tokens are accepted one after another until the first
+ * rejection, so the per token acceptance rate is estimated as `accepted / (accepted + rejections)`.
+ * With per token acceptance rate `a` and draft to main latency ratio `c`, an iteration which proposes `k` tokens
+ * yields `(1 - a^(k + 1)) / (1 - a)` tokens on average at the cost of `k * c + 1` main model inferences. The number
+ * of draft tokens maximizing this speedup is used for the next iteration. If no number of draft tokens makes the
+ * speedup exceed 1, speculation is a net loss and the request falls back to plain decoding (0 draft tokens); then it
+ * speculates with a single draft token once in PROBE_INTERVAL iterations to refresh its acceptance rate.
+ */
+class AdaptiveSpeculationController {
+public:
+    // weight of the latest observation in moving averages
+    static constexpr float SMOOTHING_FACTOR = 0.3f;
+    // number of plain decoding iterations after which a request tries to speculate again
+    static constexpr size_t PROBE_INTERVAL = 16;
+
+    /**
+     * Registers latencies of the last iteration: duration of one draft model inference and of main model inference.
+     */
+    void update_latency(float draft_duration, float main_duration) {
+        if (draft_duration <= 0.f || main_duration <= 0.f) {
+            return;
+        }
+        m_draft_duration = _smooth(m_draft_duration, draft_duration);
+        m_main_duration = _smooth(m_main_duration, main_duration);
+    }
+
+    /**
+     * Registers the result of the request's speculative decoding iteration.
+     * @return The number of draft tokens for the next iteration, 0 to skip speculation.
+     */
+    size_t update(uint64_t request_id, size_t max_num_assistant_tokens, size_t num_proposed_tokens, size_t num_accepted_tokens) {
+        RequestState& state = _get_state(request_id, max_num_assistant_tokens);
+        if (num_proposed_tokens > 0) {
+            num_accepted_tokens = std::min(num_accepted_tokens, num_proposed_tokens);
+            state.num_accepted_tokens = _smooth(state.num_accepted_tokens, static_cast<float>(num_accepted_tokens));
+            state.num_rejections = _smooth(state.num_rejections, num_accepted_tokens < num_proposed_tokens ? 1.f : 0.f);
+            state.num_assistant_tokens = compute_num_assistant_tokens(state.get_acceptance_rate(), get_latency_ratio(), max_num_assistant_tokens);
+            state.num_plain_iterations = 0;
+        } else if (state.num_assistant_tokens == 0 && ++state.num_plain_iterations >= PROBE_INTERVAL) {
+            state.num_assistant_tokens = 1;
+            state.num_plain_iterations = 0;
+        }
+        return state.num_assistant_tokens;
+    }
+
+    /**
+     * @return Estimated per token acceptance rate of the request, 0 if it's unknown.
+     */
+    float get_acceptance_rate(uint64_t request_id) const {
+        auto it = m_requests.find(request_id);
+        return it == m_requests.end() || it->second.num_accepted_tokens < 0.f ? 0.f : it->second.get_acceptance_rate();
+    }
+
+    /**
+     * @return The number of draft tokens for the request's next iteration, `max_num_assistant_tokens` for a new request.
+     */
+    size_t get_num_assistant_tokens(uint64_t request_id, size_t max_num_assistant_tokens) const {
+        auto it = m_requests.find(request_id);
+        return it == m_requests.end() ? max_num_assistant_tokens : std::min(it->second.num_assistant_tokens, max_num_assistant_tokens);
+    }
+
+    void remove_request(uint64_t request_id) {
+        m_requests.erase(request_id);
+    }
+
+    /**
+     * @return Draft to main model latency ratio, 0 until latencies are measured.
+     */
+    float get_latency_ratio() const {
+        return m_main_duration > 0.f ? m_draft_duration / m_main_duration : 0.f;
+    }
+
+    static size_t compute_num_assistant_tokens(float acceptance_rate, float latency_ratio, size_t max_num_assistant_tokens) {
+        size_t best_num_assistant_tokens = 0;
+        // plain decoding yields one token per main model inference
+        float best_speedup = 1.f;
+        for (size_t k = 1; k <= max_num_assistant_tokens; ++k) {
+            const float num_expected_tokens = acceptance_rate < 1.f
+                ? (1.f - std::pow(acceptance_rate, static_cast<float>(k + 1))) / (1.f - acceptance_rate)
+                : static_cast<float>(k + 1);
+            const float speedup = num_expected_tokens / (k * latency_ratio + 1.f);
+            if (speedup > best_speedup) {
+                best_speedup = speedup;
+                best_num_assistant_tokens = k;
+            }
+        }
+        return best_num_assistant_tokens;
+    }
+
+private:
+    struct RequestState {
+        float num_accepted_tokens;
+        float num_rejections;
+        size_t num_assistant_tokens;
+        size_t num_plain_iterations;
+
+        float get_acceptance_rate() const {
+            return num_accepted_tokens + num_rejections > 0.f ? num_accepted_tokens / (num_accepted_tokens + num_rejections) : 0.f;
+        }
+    };
+
+    std::unordered_map<uint64_t, RequestState> m_requests;
+    float m_draft_duration = -1.f, m_main_duration = -1.f;
+
+    RequestState& _get_state(uint64_t request_id, size_t max_num_assistant_tokens) {
+        // a new request speculates with the maximal number of draft tokens until its acceptance rate is observed
+        return m_requests.try_emplace(request_id, RequestState{-1.f, -1.f, max_num_assistant_tokens, 0}).first->second;
+    }
+
+    // negative average means there were no observations yet
+    static float _smooth(float average, float value) {
+        return average < 0.f ? value : (1.f - SMOOTHING_FACTOR) * average + SMOOTHING_FACTOR * value;
+    }
+};
+
+}  // namespace ov::genai
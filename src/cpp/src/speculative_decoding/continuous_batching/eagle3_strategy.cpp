@@ -93,6 +93,8 @@ ContinuousBatchingPipeline::Eagle3DecodingImpl::add_request(uint64_t request_id,
                                                                  std::optional<ov::Tensor> token_type_ids,
                                                                  std::optional<ov::Tensor> prompt_ids,
                                                                  std::optional<std::unordered_map<std::string, ov::Tensor>> lm_extra_inputs) {
+    OPENVINO_ASSERT(sampling_params.num_assistant_branches == 1, "Eagle3 doesn't support num_assistant_branches > 1");
+    OPENVINO_ASSERT(!sampling_params.adaptive_num_assistant_tokens, "Eagle3 doesn't support adaptive_num_assistant_tokens");
     std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
@@ -107,6 +109,8 @@ GenerationHandle
 ContinuousBatchingPipeline::Eagle3DecodingImpl::add_request(uint64_t request_id,
                                                                  const std::string& prompt,
                                                                  const ov::genai::GenerationConfig& sampling_params) {
+    OPENVINO_ASSERT(sampling_params.num_assistant_branches == 1, "Eagle3 doesn't support num_assistant_branches > 1");
+    OPENVINO_ASSERT(!sampling_params.adaptive_num_assistant_tokens, "Eagle3 doesn't support adaptive_num_assistant_tokens");
     std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
@@ -137,6 +141,8 @@ std::vector<EncodedGenerationResult> ContinuousBatchingPipeline::Eagle3DecodingI
                                       ov::Tensor& draft_in) {
         OPENVINO_ASSERT(main_cfg.assistant_confidence_threshold == 0.f,
                         "Eagle3 only supports num_assistant_tokens (assistant_confidence_threshold must be 0.f)");
+        OPENVINO_ASSERT(main_cfg.num_assistant_branches == 1, "Eagle3 doesn't support num_assistant_branches > 1");
+        OPENVINO_ASSERT(!main_cfg.adaptive_num_assistant_tokens, "Eagle3 doesn't support adaptive_num_assistant_tokens");
         if (main_cfg.num_assistant_tokens == 0) {
             main_cfg.num_assistant_tokens = m_main_pipeline->default_num_assistant_tokens;
             draft_cfg.num_assistant_tokens = main_cfg.num_assistant_tokens;
@@ -83,6 +83,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::init_speculative_models(con
 
         main_scheduler_config_updated.cache_size = main_cache_size;
         draft_scheduler_config.cache_size = draft_cache_size;
+        // spill file is bound to the KV cache layout of a single model
+        draft_scheduler_config.prefix_cache_spill_path.clear();
     } else {
         draft_scheduler_config.dynamic_split_fuse = main_scheduler_config_updated.dynamic_split_fuse;
         draft_scheduler_config.max_num_batched_tokens = main_scheduler_config_updated.max_num_batched_tokens;
@@ -105,11 +107,17 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     // todo: remove this condition after support of CVS-154103
     OPENVINO_ASSERT(are_tokenizers_equal(main_model_tokenizer, draft_model_tokenizer), "Tokenizers for draft and main models are different!");
     m_tokenizer = main_model_tokenizer;
+    ov::AnyMap main_properties = main_model_desc.properties;
     ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+    m_is_pipelined = utils::pop_or_default(main_properties, ov::genai::pipelined_speculative_decoding.name(), false);
+    m_is_pipelined = utils::pop_or_default(draft_properties, ov::genai::pipelined_speculative_decoding.name(), m_is_pipelined);
+    if (m_is_pipelined) {
+        m_draft_executor = std::make_unique<ThreadPool>(1);
+    }
     // to create `main_pipeline` with enabled validation_mode and `draft_pipeline` with disabled validation mode
     m_main_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         main_model_desc.model, main_model_tokenizer, main_model_desc.generation_config,
-        scheduler_configs.first, main_device, main_model_desc.properties, true);
+        scheduler_configs.first, main_device, main_properties, true);
     m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         draft_model_desc.model, draft_model_tokenizer, draft_model_desc.generation_config,
         scheduler_configs.second, draft_device, draft_properties, false);
@@ -174,33 +182,94 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_draft_pipeline->pull_awaiting_requests(true);
     m_main_pipeline->pull_awaiting_requests();
 
-    // generate candidates by draft model
-    const auto draft_start = std::chrono::steady_clock::now();
-    m_draft_pipeline->multistep();
-    const auto draft_end = std::chrono::steady_clock::now();
-    m_sd_metrics.draft_duration += PerfMetrics::get_microsec(draft_end - draft_start) / 1e6;
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
-
+    size_t num_draft_inferences = 0;
+    float draft_duration = 0.f, main_duration = 0.f;
+    std::chrono::steady_clock::time_point main_end;
     // to generate num_matches statistic
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
-    // put candidates to model KV cache
-    auto draft_generated_requests = m_draft_pipeline->get_generated_requests();
-    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
-        auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
-        update_sequence_info.insert({{candidate.first, update_result}});
-    }
+    GeneratedRequests draft_generated_requests, main_generated_requests;
+
+    if (m_is_pipelined) {
+        // draft model generates candidates for requests from `m_drafting_requests`, while main model validates the others
+        auto draft_future = m_draft_executor->submit([this] {
+            const auto draft_start = std::chrono::steady_clock::now();
+            const size_t num_inferences = m_draft_pipeline->multistep();
+            return std::make_pair(num_inferences, PerfMetrics::get_microsec(std::chrono::steady_clock::now() - draft_start));
+        });
+        const auto main_start = std::chrono::steady_clock::now();
+        try {
+            m_main_pipeline->step();
+        } catch (...) {
+            draft_future.wait();
+            throw;
+        }
+        main_end = std::chrono::steady_clock::now();
+        main_duration = PerfMetrics::get_microsec(main_end - main_start);
+        std::tie(num_draft_inferences, draft_duration) = draft_future.get();
+        m_sd_metrics.draft_duration += draft_duration / 1e6;
+        m_sd_metrics.main_duration += main_duration / 1e6;
+        m_pipeline_metrics = m_main_pipeline->get_metrics();
+
+        // hand the requests over: candidates go to main model for validation, validated tokens go to draft model
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        main_generated_requests = m_main_pipeline->get_generated_requests();
+        std::set<uint64_t> drafting_requests;
+        for (const auto& [request_id, validated_sequences] : main_generated_requests) {
+            if (m_drafting_requests.count(request_id)) {
+                auto candidates = draft_generated_requests.find(request_id);
+                if (candidates != draft_generated_requests.end()) {
+                    m_validated_candidates[request_id] = m_main_pipeline->update_request(request_id, candidates->second, false);
+                }
+                m_main_pipeline->pause_request(request_id, false);
+                m_draft_pipeline->pause_request(request_id, true);
+            } else {
+                auto validated_candidates = m_validated_candidates.find(request_id);
+                if (validated_candidates != m_validated_candidates.end()) {
+                    update_sequence_info[request_id] = validated_candidates->second;
+                    m_validated_candidates.erase(validated_candidates);
+                }
+                auto update_result = m_draft_pipeline->update_request(request_id, validated_sequences, true);
+                update_sequence_info[request_id].removed_tokens_cnt = update_result.removed_tokens_cnt;
+                if (m_draft_pipeline->is_speculation_suspended(request_id)) {
+                    // no candidates would come from draft model, so main model keeps decoding the request every step
+                    continue;
+                }
+                m_main_pipeline->pause_request(request_id, true);
+                drafting_requests.insert(request_id);
+            }
+        }
+        m_drafting_requests = std::move(drafting_requests);
+        for (auto it = m_validated_candidates.begin(); it != m_validated_candidates.end();) {
+            it = main_generated_requests.count(it->first) ? std::next(it) : m_validated_candidates.erase(it);
+        }
+    } else {
+        // generate candidates by draft model
+        const auto draft_start = std::chrono::steady_clock::now();
+        num_draft_inferences = m_draft_pipeline->multistep();
+        const auto draft_end = std::chrono::steady_clock::now();
+        draft_duration = PerfMetrics::get_microsec(draft_end - draft_start);
+        m_sd_metrics.draft_duration += draft_duration / 1e6;
+        m_pipeline_metrics = m_main_pipeline->get_metrics();
+
+        // put candidates to model KV cache
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        for (const auto& candidate : draft_generated_requests) {
+            auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
+            update_sequence_info.insert({{candidate.first, update_result}});
+        }
 
-    const auto main_start = std::chrono::steady_clock::now();
-    m_main_pipeline->step();
-    const auto main_end = std::chrono::steady_clock::now();
-    const auto main_duration = PerfMetrics::get_microsec(main_end - main_start);
-    m_sd_metrics.main_duration += main_duration / 1e6;
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
-
-    auto main_generated_requests = m_main_pipeline->get_generated_requests();
-    for (const auto& checked_sequence : main_generated_requests) {
-        auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
-        update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
+        const auto main_start = std::chrono::steady_clock::now();
+        m_main_pipeline->step();
+        main_end = std::chrono::steady_clock::now();
+        main_duration = PerfMetrics::get_microsec(main_end - main_start);
+        m_sd_metrics.main_duration += main_duration / 1e6;
+        m_pipeline_metrics = m_main_pipeline->get_metrics();
+
+        main_generated_requests = m_main_pipeline->get_generated_requests();
+        for (const auto& checked_sequence : main_generated_requests) {
+            auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
+            update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
+        }
     }
 
     // finish draft request if the generation was completed
@@ -222,6 +291,19 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
     }
+    const float draft_inference_duration = num_draft_inferences > 0 ? draft_duration / num_draft_inferences : 0.f;
+    m_draft_pipeline->update_num_assistant_tokens(update_sequence_info, draft_inference_duration, main_duration);
+    if (m_is_pipelined) {
+        // requests whose speculation has just been suspended return to main model instead of waiting a step for no candidates
+        for (auto it = m_drafting_requests.begin(); it != m_drafting_requests.end();) {
+            if (m_draft_pipeline->is_speculation_suspended(*it)) {
+                m_main_pipeline->pause_request(*it, false);
+                it = m_drafting_requests.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
 
     const auto step_end = std::chrono::steady_clock::now();
     const auto step_microsec_duration = PerfMetrics::get_microsec(step_end - step_start);
@@ -6,6 +6,7 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "continuous_batching/pipeline_impl.hpp"
 #include "openvino/genai/speculative_decoding/perf_metrics.hpp"
+#include "sampling/threadpool.hpp"
 #include "speculative_decoding/continuous_batching/pipeline_impl.hpp"
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
 #include "utils.hpp"
@@ -148,6 +149,14 @@ protected:
     std::mutex m_draft_generations_mutex;
     std::map<uint64_t, GenerationHandle> m_draft_generations;
 
+    // Pipelined mode: draft model generates candidates for `m_drafting_requests` on `m_draft_executor`,
+    // while main model validates candidates of the other requests
+    bool m_is_pipelined = false;
+    std::unique_ptr<ThreadPool> m_draft_executor;
+    std::set<uint64_t> m_drafting_requests;
+    // candidates inserted to main model, which are validated at the next step
+    std::map<int64_t, UpdateRequestResult> m_validated_candidates;
+
     void drop_requests();
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
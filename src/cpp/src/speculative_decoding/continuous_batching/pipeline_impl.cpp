@@ -31,6 +31,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::finish
         }
     }
     m_sampler->clear_request_info(request->get_request_id());
+    m_adaptive_speculation.remove_request(request->get_request_id());
     request->set_generation_status(GenerationStatus::STOP);
 }
 
@@ -239,6 +240,51 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::init_r
     return {0, 0};
 }
 
+void
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::sync_assistant_branches(SequenceGroup::Ptr request,
+                                                                                                  const GeneratedSequences& candidates) {
+    std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
+    auto is_running = [&running_sequences](uint64_t grouped_id) {
+        return std::any_of(running_sequences.begin(), running_sequences.end(), [grouped_id](const Sequence::Ptr& sequence) {
+            return sequence->get_grouped_id() == grouped_id;
+        });
+    };
+
+    if (m_is_validation_mode_enabled) {
+        // draft model branches off the only sequence of main model, which is forked to validate all the branches at once
+        if (running_sequences.size() != 1) {
+            return;
+        }
+        const auto& parent = running_sequences.front();
+        for (const auto& candidate : candidates) {
+            if (is_running(candidate.first)) {
+                continue;
+            }
+            const auto branch = request->fork_sequence(parent, candidate.first);
+            if (m_scheduler->has_block_table(parent->get_id())) {
+                m_scheduler->fork_sequence(parent->get_id(), branch->get_id());
+            }
+        }
+    } else {
+        // main model keeps only the longest accepted branch, the other draft model branches are dropped
+        const bool has_kept_branch = std::any_of(candidates.begin(), candidates.end(), [&is_running](const auto& candidate) {
+            return is_running(candidate.first);
+        });
+        if (!has_kept_branch) {
+            return;
+        }
+        for (const auto& sequence : running_sequences) {
+            if (candidates.count(sequence->get_grouped_id())) {
+                continue;
+            }
+            if (m_scheduler->has_block_table(sequence->get_id())) {
+                m_scheduler->free_sequence(sequence->get_id());
+            }
+            request->remove_sequence(sequence->get_id());
+        }
+    }
+}
+
 UpdateRequestResult
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update_request(uint64_t request_id,
                                                                                          const GeneratedSequences& candidates,
@@ -267,6 +313,10 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
         } else {
             // update existing sequences by the candidates
             auto& logit_processor = m_sampler->get_logit_processor(request_id);
+            if (request->get_sampling_parameters().num_assistant_branches > 1) {
+                sync_assistant_branches(request, candidates);
+                running_sequences = request->get_running_sequences();
+            }
             std::tie(min_generated_tokens, min_candidate_len) = get_prefix_len(running_sequences, candidates);
 
             for (auto& running_sequence : running_sequences) {
@@ -319,7 +369,10 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             }
         }
         if (num_tokens_needs_kv_update < 0 && result.inserted_tokens_cnt > 0 && result.removed_tokens_cnt == 0) {
-            request->set_num_validated_tokens(result.inserted_tokens_cnt);
+            // draft model skips requests decoded without speculation, so tokens inserted by several updates wait for it together
+            const bool is_draft_lagging = !m_is_validation_mode_enabled && request->get_sampling_parameters().adaptive_num_assistant_tokens;
+            const size_t num_waiting_tokens = is_draft_lagging ? request->get_num_tokens_to_validate() : 0;
+            request->set_num_validated_tokens(num_waiting_tokens + result.inserted_tokens_cnt);
         } else if (num_tokens_needs_kv_update >= 0) {
             request->set_num_validated_tokens(num_tokens_needs_kv_update);  // in generation stage
         }
@@ -336,6 +389,9 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             if (generated_len >= max_new_tokens - 1 || generated_len != 0 && result.inserted_tokens_cnt == 0) {
                 pause_gen_status = true;
             }
+            if (request->get_sampling_parameters().adaptive_num_assistant_tokens && get_num_assistant_tokens(request) == 0) {
+                pause_gen_status = true;
+            }
             request->pause_generation(pause_gen_status);
         }
         break;
@@ -347,6 +403,15 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::i
     return m_requests.empty();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pause_request(uint64_t request_id, bool is_paused) {
+    for (auto& request : m_requests) {
+        if (request->get_request_id() == request_id) {
+            request->pause_generation(is_paused);
+            break;
+        }
+    }
+}
+
 size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_processed_tokens_per_iteration() {
     return m_batch_size;
 }
@@ -363,9 +428,51 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
-void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
+size_t
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_num_assistant_tokens(const SequenceGroup::Ptr& request) const {
+    const auto& sampling_params = request->get_sampling_parameters();
+    if (!sampling_params.adaptive_num_assistant_tokens) {
+        return sampling_params.num_assistant_tokens;
+    }
+    return m_adaptive_speculation.get_num_assistant_tokens(request->get_request_id(), sampling_params.num_assistant_tokens);
+}
+
+void
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update_num_assistant_tokens(const std::map<int64_t, UpdateRequestResult>& update_results,
+                                                                                                      float draft_duration,
+                                                                                                      float main_duration) {
+    m_adaptive_speculation.update_latency(draft_duration, main_duration);
+    for (auto& request : m_requests) {
+        const auto& sampling_params = request->get_sampling_parameters();
+        if (!sampling_params.adaptive_num_assistant_tokens) {
+            continue;
+        }
+        const auto request_id = request->get_request_id();
+        size_t num_proposed_tokens = 0, num_accepted_tokens = 0;
+        auto update_result = update_results.find(request_id);
+        if (update_result != update_results.end()) {
+            num_proposed_tokens = update_result->second.inserted_tokens_cnt;
+            num_accepted_tokens = num_proposed_tokens - std::min(update_result->second.removed_tokens_cnt, num_proposed_tokens);
+        }
+        if (m_adaptive_speculation.update(request_id, sampling_params.num_assistant_tokens, num_proposed_tokens, num_accepted_tokens) == 0) {
+            // main model decodes the request alone, the draft one catches up when speculation is resumed
+            request->pause_generation(true);
+        }
+    }
+}
+
+bool ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::is_speculation_suspended(uint64_t request_id) const {
+    for (const auto& request : m_requests) {
+        if (request->get_request_id() == request_id) {
+            return request->get_sampling_parameters().adaptive_num_assistant_tokens && get_num_assistant_tokens(request) == 0;
+        }
+    }
+    return false;
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
-    size_t generated_tokens_cnt = 0;
+    size_t generated_tokens_cnt = 0, num_inferences = 0;
 
     // cycle to generate several tokens per one iteration for speculative decoding case
     while (to_generate) {
@@ -379,6 +486,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
         const auto num_generated_tokens = get_processed_tokens_per_iteration();
         auto pipeline_metrics = get_metrics();
         if (num_generated_tokens > 0) {
+            num_inferences++;
             raw_perf_metrics.m_durations.emplace_back(generation_duration);
             raw_perf_metrics.m_inference_durations[0] += MicroSeconds(pipeline_metrics.inference_duration);
             raw_perf_metrics.m_batch_sizes.emplace_back(num_generated_tokens);
@@ -397,7 +505,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == 0 && sampling_params.num_return_sequences > 1) {
                 request->pause_generation(true);
-            } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
+            } else if (get_num_assistant_tokens(request) <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
                 request->pause_generation(true);
             } else if (request->get_max_new_tokens() == 0) {
                 request->pause_generation(true);
@@ -411,5 +519,6 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
     }
     if (eagle_mode_enabled)
         m_model_runner->enable_hidden_state_import(true);
+    return num_inferences;
 }
 }
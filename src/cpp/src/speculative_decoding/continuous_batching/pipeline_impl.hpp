@@ -5,6 +5,7 @@
 
 #include "continuous_batching/pipeline_impl.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "speculative_decoding/adaptive_speculation_controller.hpp"
 #include "update_request_structs.hpp"
 
 namespace ov::genai {
@@ -22,24 +23,44 @@ public:
                                                  const ov::AnyMap& plugin_config,
                                                  bool is_validation_mode_enabled);
 
-    void multistep();
+    // returns the number of performed inferences
+    size_t multistep();
 
     void finish_request(int64_t request_id = -1);
     void pull_awaiting_requests(bool is_pause_request = false);
     GeneratedRequests get_generated_requests();
     UpdateRequestResult update_request(uint64_t request_id, const GeneratedSequences& candidates, bool is_update_logit_processor);
     bool is_requests_empty();
+    // excludes the request from (or returns it to) scheduling until the next call
+    void pause_request(uint64_t request_id, bool is_paused);
 
     size_t get_processed_tokens_per_iteration();
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    /**
+     * Chooses the number of candidates for the next iteration of requests with `adaptive_num_assistant_tokens`.
+     * @param update_results the numbers of candidates inserted to main model and removed after validation per request.
+     * @param draft_duration duration of one draft model inference.
+     * @param main_duration duration of main model inference.
+     */
+    void update_num_assistant_tokens(const std::map<int64_t, UpdateRequestResult>& update_results, float draft_duration, float main_duration);
+
+    /**
+     * @return Whether `adaptive_num_assistant_tokens` chose to decode the request by main model alone, without candidates.
+     */
+    bool is_speculation_suspended(uint64_t request_id) const;
+
     RawPerfMetrics raw_perf_metrics;
 
 protected:
     void finish_request(SequenceGroup::Ptr request);
+    // mirrors candidate branches of tree speculative decoding (`num_assistant_branches > 1`) in the request's sequences
+    void sync_assistant_branches(SequenceGroup::Ptr request, const GeneratedSequences& candidates);
     void _pull_awaiting_requests() override {};
+    size_t get_num_assistant_tokens(const SequenceGroup::Ptr& request) const;
     bool eagle_mode_enabled = false;
+    AdaptiveSpeculationController m_adaptive_speculation;
 };
 
 class ContinuousBatchingPipeline::ContinuousBatchingForEagle3DecodingImpl
@@ -27,6 +27,8 @@ void StatefulSpeculativePipelineBase::ensure_num_assistant_tokens_is_set(Generat
         config.assistant_confidence_threshold == 0.f,
         "Stateful (non-Continuous Batching) Speculative Decoding pipeline only supports num_assistant_tokens, "
         "not assistant_confidence_threshold. Set assistant_confidence_threshold to 0.f or remove its specification.");
+    OPENVINO_ASSERT(config.num_assistant_branches == 1,
+                    "Stateful (non-Continuous Batching) Speculative Decoding pipeline doesn't support num_assistant_branches > 1.");
 
     if (config.num_assistant_tokens == 0) {
         config.num_assistant_tokens = DEFAULT_NUM_ASSISTANT_TOKENS;
@@ -3,6 +3,9 @@
 
 #include "openvino/genai/text_streamer.hpp"
 
+#include "tokenizer/incremental_detokenizer.hpp"
+#include "tokenizer/tokenizer_impl.hpp"
+
 namespace {
 bool is_incomplete(std::string& text) {
     // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
@@ -12,6 +15,16 @@ bool is_incomplete(std::string& text) {
 
 constexpr size_t delay_n_tokens = 3;
 
+// native decoding reproduces the detokenizer model with default parameters only
+bool is_default_detokenization(const ov::AnyMap& detokenization_params) {
+    for (const auto& [name, value] : detokenization_params) {
+        if (name != ov::genai::skip_special_tokens.name() || !value.as<bool>()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace
 
 namespace ov {
@@ -23,15 +36,31 @@ TextStreamer::TextStreamer(const Tokenizer& tokenizer,
     m_tokenizer = tokenizer;
     m_subword_callback = std::move(callback);
     m_additional_detokenization_params = detokenization_params;
+    if (m_tokenizer.m_pimpl && is_default_detokenization(detokenization_params)) {
+        // the table is built in background when the tokenizer is set up, the detokenizer model is used until it is ready
+        if (auto table = m_tokenizer.m_pimpl->get_token_text_table_if_ready()) {
+            m_incremental_detokenizer = std::make_shared<IncrementalDetokenizer>(table);
+        }
+    }
 }
 
 StreamingStatus TextStreamer::write(int64_t token) {
     std::stringstream res;
     m_tokens_cache.push_back(token);
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    std::string decoded_text;
+    bool is_text_incomplete;
+    if (m_incremental_detokenizer) {
+        // only the bytes of the new token are decoded, incomplete UTF-8 character is kept by the detokenizer
+        m_text += m_incremental_detokenizer->write(token);
+        is_text_incomplete = m_incremental_detokenizer->has_incomplete();
+    } else {
+        decoded_text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+        is_text_incomplete = is_incomplete(decoded_text);
+    }
+    const std::string& text = m_incremental_detokenizer ? m_text : decoded_text;
     m_decoded_lengths.push_back(text.length());
 
-    if (!text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
+    if (!is_text_incomplete && !text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
         // Flush the cache after the new line symbol
         res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len};
 
@@ -39,10 +68,14 @@ StreamingStatus TextStreamer::write(int64_t token) {
         m_tokens_cache.clear();
         m_decoded_lengths.clear();
         m_printed_len = 0;
+        if (m_incremental_detokenizer) {
+            m_text.clear();
+            m_incremental_detokenizer->reset();
+        }
         return res_status;
     }
 
-    if (is_incomplete(text)) {
+    if (is_text_incomplete) {
         m_decoded_lengths[m_decoded_lengths.size() - 1] = -1;
         // Don't print incomplete text
         return run_callback_if_needed(res.str());
@@ -96,8 +129,15 @@ StreamingStatus TextStreamer::write(const std::vector<int64_t>& tokens) {
 
     if (tokens.size() > 1) {
         m_tokens_cache.insert(m_tokens_cache.end(), tokens.begin(), tokens.end() - 1);
-        // -2 means no decode was done for this token position
-        m_decoded_lengths.resize(m_decoded_lengths.size() + tokens.size() - 1, -2);
+        if (m_incremental_detokenizer) {
+            for (auto token = tokens.begin(); token != tokens.end() - 1; ++token) {
+                m_text += m_incremental_detokenizer->write(*token);
+                m_decoded_lengths.push_back(m_incremental_detokenizer->has_incomplete() ? -1 : static_cast<int64_t>(m_text.size()));
+            }
+        } else {
+            // -2 means no decode was done for this token position
+            m_decoded_lengths.resize(m_decoded_lengths.size() + tokens.size() - 1, -2);
+        }
     }
 
     return ov::genai::TextStreamer::write(tokens.back());
@@ -120,9 +160,22 @@ StreamingStatus TextStreamer::run_callback_if_needed(const std::string& text) {
 
 void TextStreamer::end() {
     std::stringstream res;
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
-    if (text.size() <= m_printed_len)
+    std::string text;
+    if (m_incremental_detokenizer) {
+        text = m_text + m_incremental_detokenizer->end();
+        m_text.clear();
+    } else {
+        text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    }
+    if (text.size() <= m_printed_len) {
+        if (m_incremental_detokenizer) {
+            // m_text is already flushed, the cache must not outlive it
+            m_tokens_cache.clear();
+            m_decoded_lengths.clear();
+            m_printed_len = 0;
+        }
         return;
+    }
     res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len} << std::flush;
     m_tokens_cache.clear();
     m_decoded_lengths.clear();
@@ -0,0 +1,202 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Bytes of every token for native incremental decoding, see Tokenizer::TokenizerImpl::get_token_text_table.
+ */
+struct TokenTextTable {
+    // bytes a token adds in the middle of a sequence, possibly a part of UTF-8 character
+    std::vector<std::string> m_token_bytes;
+    // the decoder drops the leading space of the text
+    bool m_strip_leading_space = false;
+};
+
+/**
+ * @brief Bytes of a byte-level BPE vocab entry: GPT-2 vocabularies spell every byte with a printable unicode character.
+ * Entries that are not spelled this way (e.g. added tokens) are returned as is.
+ */
+inline std::string byte_level_token_bytes(std::string_view token) {
+    // inverse of GPT-2 bytes_to_unicode(): code points below 324 => byte
+    static const std::array<int, 324> code_point_to_byte = [] {
+        std::array<int, 324> table;
+        table.fill(-1);
+        int num_shifted = 0;
+        for (int byte = 0; byte < 256; ++byte) {
+            const bool is_printable = (byte >= 33 && byte <= 126) || (byte >= 161 && byte <= 172) || byte >= 174;
+            table[is_printable ? byte : 256 + num_shifted++] = byte;
+        }
+        return table;
+    }();
+
+    std::string bytes;
+    bytes.reserve(token.size());
+    for (size_t pos = 0; pos < token.size();) {
+        const auto lead = static_cast<unsigned char>(token[pos]);
+        uint32_t code_point = lead;
+        size_t length = 1;
+        if (lead >= 0xC0 && lead < 0xE0 && pos + 1 < token.size()) {
+            code_point = ((lead & 0x1Fu) << 6) | (static_cast<unsigned char>(token[pos + 1]) & 0x3Fu);
+            length = 2;
+        }
+        if (code_point >= code_point_to_byte.size() || code_point_to_byte[code_point] < 0 || (length == 1 && lead >= 0x80)) {
+            return std::string(token);
+        }
+        bytes.push_back(static_cast<char>(code_point_to_byte[code_point]));
+        pos += length;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Bytes of a SentencePiece vocab entry: "▁" is a space and byte fallback entries "<0xXX>" are single bytes.
+ */
+inline std::string sentencepiece_token_bytes(std::string_view token) {
+    if (token.size() == 6 && token.substr(0, 3) == "<0x" && token.back() == '>') {
+        try {
+            return std::string(1, static_cast<char>(std::stoi(std::string(token.substr(3, 2)), nullptr, 16)));
+        } catch (const std::exception&) {
+            return std::string(token);
+        }
+    }
+    constexpr std::string_view space_symbol = "\xE2\x96\x81";
+    std::string bytes;
+    bytes.reserve(token.size());
+    for (size_t pos = 0; pos < token.size();) {
+        if (token.substr(pos, space_symbol.size()) == space_symbol) {
+            bytes.push_back(' ');
+            pos += space_symbol.size();
+        } else {
+            bytes.push_back(token[pos++]);
+        }
+    }
+    return bytes;
+}
+
+/**
+ * @brief Decodes a stream of tokens to text without running the detokenizer model.
+ *
+ * Bytes of every new token are appended to the pending ones and the longest prefix of complete UTF-8 characters is
+ * emitted, an incomplete character waits for the next tokens. So a token costs O(its bytes) regardless of the length of
+ * the text. Invalid UTF-8 sequences are replaced with U+FFFD, one per maximal invalid subpart, as the detokenizer model does.
+ */
+class IncrementalDetokenizer {
+public:
+    static constexpr std::string_view REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+
+    explicit IncrementalDetokenizer(std::shared_ptr<const TokenTextTable> table) : m_table(std::move(table)) {}
+
+    /**
+     * @return Text completed by the token.
+     */
+    std::string write(int64_t token) {
+        OPENVINO_ASSERT(token >= 0 && static_cast<size_t>(token) < m_table->m_token_bytes.size(), "Token id ", token, " is out of vocabulary");
+        const std::string& bytes = m_table->m_token_bytes[token];
+        size_t offset = 0;
+        if (m_is_text_empty && !bytes.empty()) {
+            m_is_text_empty = false;
+            if (m_table->m_strip_leading_space && bytes.front() == ' ') {
+                offset = 1;
+            }
+        }
+        m_pending.append(bytes, offset, std::string::npos);
+        return _take_complete(false);
+    }
+
+    /**
+     * @return Whether the text ends with an incomplete UTF-8 character.
+     */
+    bool has_incomplete() const {
+        return !m_pending.empty();
+    }
+
+    /**
+     * @return The rest of the text with an incomplete character replaced with U+FFFD. Starts a new text.
+     */
+    std::string end() {
+        std::string text = _take_complete(true);
+        reset();
+        return text;
+    }
+
+    void reset() {
+        m_pending.clear();
+        m_is_text_empty = true;
+    }
+
+private:
+    std::shared_ptr<const TokenTextTable> m_table;
+    // bytes of an incomplete UTF-8 character
+    std::string m_pending;
+    bool m_is_text_empty = true;
+
+    // Length of UTF-8 character at `pos`; -n for n bytes of invalid sequence; 0 if the character is not complete yet
+    static ptrdiff_t _char_length(std::string_view text, size_t pos) {
+        const auto lead = static_cast<unsigned char>(text[pos]);
+        if (lead < 0x80)
+            return 1;
+        size_t length = 0;
+        unsigned char second_min = 0x80, second_max = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            // overlong encodings and surrogates
+            second_min = lead == 0xE0 ? 0xA0 : 0x80;
+            second_max = lead == 0xED ? 0x9F : 0xBF;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            // overlong encodings and code points above U+10FFFF
+            second_min = lead == 0xF0 ? 0x90 : 0x80;
+            second_max = lead == 0xF4 ? 0x8F : 0xBF;
+        } else {
+            return -1;
+        }
+        for (size_t i = 1; i < length; ++i) {
+            if (pos + i == text.size())
+                return 0;
+            const auto byte = static_cast<unsigned char>(text[pos + i]);
+            const unsigned char min = i == 1 ? second_min : 0x80, max = i == 1 ? second_max : 0xBF;
+            if (byte < min || byte > max)
+                return -static_cast<ptrdiff_t>(i);
+        }
+        return static_cast<ptrdiff_t>(length);
+    }
+
+    std::string _take_complete(bool flush) {
+        std::string text;
+        size_t pos = 0;
+        while (pos < m_pending.size()) {
+            const ptrdiff_t length = _char_length(m_pending, pos);
+            if (length > 0) {
+                text.append(m_pending, pos, static_cast<size_t>(length));
+                pos += static_cast<size_t>(length);
+            } else if (length < 0) {
+                text.append(REPLACEMENT_CHARACTER);
+                pos += static_cast<size_t>(-length);
+            } else if (flush) {
+                text.append(REPLACEMENT_CHARACTER);
+                pos = m_pending.size();
+            } else {
+                break;
+            }
+        }
+        m_pending.erase(0, pos);
+        return text;
+    }
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,236 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief LRU cache of token ids of text segments, enabled by ov::genai::tokenization_cache_size.
+ *
+ * Tokenizer models split the text by special tokens before tokenization, so segments between them are tokenized
+ * independently. Rendered chat templates repeat previous turns and system prompt between role tokens, so only the new
+ * segments are run through the tokenizer model while the rest are taken from the cache.
+ */
+class TokenizationCache {
+public:
+    struct Segment {
+        std::string_view text;
+        // -1 for text
+        int64_t special_token_id = -1;
+    };
+
+    /**
+     * @param max_num_tokens Budget of the cache in token ids.
+     */
+    explicit TokenizationCache(size_t max_num_tokens) : m_max_num_tokens(max_num_tokens) {}
+
+    /**
+     * @brief Sets special tokens to split the text by. Must be called before the cache is shared between threads.
+     */
+    void set_special_tokens(const std::vector<std::pair<std::string, int64_t>>& special_tokens) {
+        for (auto& candidates : m_special_tokens) {
+            candidates.clear();
+        }
+        for (const auto& [token, id] : special_tokens) {
+            if (!token.empty()) {
+                m_special_tokens[static_cast<unsigned char>(token.front())].emplace_back(token, id);
+            }
+        }
+        // the longest match wins like in tokenizer models
+        for (auto& candidates : m_special_tokens) {
+            std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first.size() > rhs.first.size();
+            });
+        }
+    }
+
+    std::vector<Segment> split(std::string_view text) const {
+        std::vector<Segment> segments;
+        size_t begin = 0;
+        for (size_t pos = 0; pos < text.size();) {
+            const auto& candidates = m_special_tokens[static_cast<unsigned char>(text[pos])];
+            auto match = std::find_if(candidates.begin(), candidates.end(), [&](const auto& candidate) {
+                return text.compare(pos, candidate.first.size(), candidate.first) == 0;
+            });
+            if (match == candidates.end()) {
+                ++pos;
+                continue;
+            }
+            if (pos > begin) {
+                segments.push_back({text.substr(begin, pos - begin)});
+            }
+            segments.push_back({text.substr(pos, match->first.size()), match->second});
+            pos += match->first.size();
+            begin = pos;
+        }
+        if (begin < text.size()) {
+            segments.push_back({text.substr(begin)});
+        }
+        return segments;
+    }
+
+    /**
+     * @brief Appends cached token ids of the segment to `token_ids`.
+     * @return Whether the segment is cached.
+     */
+    bool append_cached(std::string_view segment, std::vector<int64_t>& token_ids) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(segment);
+        if (it == m_entries.end()) {
+            ++m_stats.misses;
+            return false;
+        }
+        ++m_stats.hits;
+        m_lru_list.splice(m_lru_list.begin(), m_lru_list, it->second);
+        token_ids.insert(token_ids.end(), it->second->second.begin(), it->second->second.end());
+        return true;
+    }
+
+    void put(std::string_view segment, std::vector<int64_t> token_ids) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (token_ids.size() > m_max_num_tokens || m_entries.count(segment)) {
+            return;
+        }
+        m_stats.num_cached_tokens += token_ids.size();
+        m_lru_list.emplace_front(std::string(segment), std::move(token_ids));
+        // keys point to the strings of list nodes which are never moved
+        m_entries.emplace(m_lru_list.front().first, m_lru_list.begin());
+        while (m_stats.num_cached_tokens > m_max_num_tokens) {
+            _evict();
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_lru_list.clear();
+        m_stats.num_cached_tokens = 0;
+    }
+
+    TokenizationCacheStats get_stats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+private:
+    using LRUList = std::list<std::pair<std::string, std::vector<int64_t>>>;
+
+    size_t m_max_num_tokens;
+    // candidates by the first byte, the longest ones first
+    std::array<std::vector<std::pair<std::string, int64_t>>, 256> m_special_tokens;
+
+    mutable std::mutex m_mutex;
+    LRUList m_lru_list;
+    std::unordered_map<std::string_view, LRUList::iterator> m_entries;
+    TokenizationCacheStats m_stats;
+
+    void _evict() {
+        auto& [segment, token_ids] = m_lru_list.back();
+        m_stats.num_cached_tokens -= token_ids.size();
+        m_entries.erase(segment);
+        m_lru_list.pop_back();
+    }
+};
+
+namespace detail {
+
+inline bool is_false(const nlohmann::json& object, const char* key) {
+    return object.contains(key) && object[key].is_boolean() && !object[key].get<bool>();
+}
+
+inline bool is_true(const nlohmann::json& object, const char* key) {
+    return object.contains(key) && object[key].is_boolean() && object[key].get<bool>();
+}
+
+// whether a normalizer or pre-tokenizer step tokenizes a segment differently depending on where the text was split
+inline bool depends_on_segment_boundaries(const nlohmann::json& step) {
+    if (step.is_array()) {
+        return std::any_of(step.begin(), step.end(), depends_on_segment_boundaries);
+    }
+    if (!step.is_object()) {
+        return false;
+    }
+    const std::string type = step.contains("type") && step["type"].is_string() ? step["type"].get<std::string>() : "";
+    // SentencePiece dummy prefix and whitespace stripping are applied to each segment
+    if (type == "Prepend" || type == "Strip") {
+        return true;
+    }
+    if (type == "Metaspace") {
+        if (step.contains("prepend_scheme") && step["prepend_scheme"].is_string()) {
+            return step["prepend_scheme"].get<std::string>() != "never";
+        }
+        return !is_false(step, "add_prefix_space");
+    }
+    if (type == "ByteLevel" && !is_false(step, "add_prefix_space")) {
+        return true;
+    }
+    // Sequence keeps its steps in nested arrays
+    for (const auto& [key, value] : step.items()) {
+        if ((value.is_array() || value.is_object()) && depends_on_segment_boundaries(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Finds added tokens which the text can be split at without changing its tokenization.
+ *
+ * Tokenizers split the text by added tokens and normalize and pre-tokenize each segment separately. A segment is
+ * tokenized alone the same way only if the added token doesn't strip whitespace around it (lstrip, rstrip), isn't
+ * matched in normalized text (normalized) or as a whole word (single_word), and no step adds a prefix to a segment or
+ * strips it, like the SentencePiece dummy prefix.
+ * @param tokenizer_json Hugging Face tokenizer.json.
+ * @param tokenizer_config Hugging Face tokenizer_config.json, its flags override the prefix handling of tokenizer.json.
+ * @return Contents of such added tokens, std::nullopt if splitting changes tokenization of segments regardless of tokens.
+ */
+inline std::optional<std::unordered_set<std::string>> get_splittable_added_tokens(const nlohmann::json& tokenizer_json,
+                                                                                  const nlohmann::json& tokenizer_config) {
+    if (!tokenizer_json.is_object() || !tokenizer_json.contains("added_tokens") || !tokenizer_json["added_tokens"].is_array()) {
+        return std::nullopt;
+    }
+    for (const char* key : {"normalizer", "pre_tokenizer"}) {
+        if (tokenizer_json.contains(key) && detail::depends_on_segment_boundaries(tokenizer_json[key])) {
+            return std::nullopt;
+        }
+    }
+    // legacy=false makes Llama tokenizers handle the text after special tokens differently
+    if (tokenizer_config.is_object() &&
+        (detail::is_true(tokenizer_config, "add_prefix_space") || detail::is_false(tokenizer_config, "legacy"))) {
+        return std::nullopt;
+    }
+
+    std::unordered_set<std::string> added_tokens;
+    for (const auto& token : tokenizer_json["added_tokens"]) {
+        if (!token.is_object() || !token.contains("content") || !token["content"].is_string()) {
+            continue;
+        }
+        if (detail::is_false(token, "lstrip") && detail::is_false(token, "rstrip") &&
+            detail::is_false(token, "single_word") && detail::is_false(token, "normalized")) {
+            added_tokens.insert(token["content"].get<std::string>());
+        }
+    }
+    return added_tokens;
+}
+
+}  // namespace ov::genai
@@ -172,6 +172,10 @@ bool Tokenizer::supports_paired_input() const {
     return m_pimpl->is_paired_input;
 }
 
+TokenizationCacheStats Tokenizer::get_tokenization_cache_stats() const {
+    return m_pimpl->m_tokenization_cache ? m_pimpl->m_tokenization_cache->get_stats() : TokenizationCacheStats{};
+}
+
 Tokenizer::~Tokenizer() {
     m_pimpl.reset();
 
@@ -3,9 +3,11 @@
 
 #include "tokenizer/tokenizer_impl.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include "add_second_input_pass.hpp"
+#include "logger.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 #include "openvino/genai/version.hpp"
 
@@ -44,6 +46,8 @@ ov::Core get_core_singleton() {
 constexpr char bos_token_key_name[] = "bos_token";
 constexpr char eos_token_key_name[] = "eos_token";
 constexpr char pad_token_key_name[] = "pad_token";
+// number of the first encodings with the tokenization cache which are compared with the tokenizer model
+constexpr size_t NUM_VERIFIED_CACHED_ENCODINGS = 8;
 std::string remap_template(const std::string& chat_template) {
     for (const auto& [known, fallback] : chat_template_fallback_map) {
         if (chat_template == known) {
@@ -346,6 +350,7 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::filesystem::path& mode
     read_special_tokens_map(models_path);
     // Try to read tokenizer_config if some token ids or token str are not defined.
     read_tokenizer_config_if_necessary(models_path);
+    read_splittable_added_tokens(models_path);
     parse_chat_template_from_file(models_path / "tokenizer_config.json", m_chat_template);
     parse_chat_template_from_file(models_path / "processor_config.json", m_chat_template);
     parse_chat_template_from_file(models_path / "chat_template.json", m_chat_template);
@@ -364,6 +369,8 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
         properties.erase(it);
     }
 
+    const size_t tokenization_cache_size = ov::genai::utils::pop_or_default<size_t>(properties, ov::genai::tokenization_cache_size.name(), 0);
+
     // Filter properties by leaving only params from the allowlist
     filter_properties(properties);
     
@@ -499,6 +506,83 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
 
         m_vocab = read_vocab_from_detokenizer_model(ov_detokenizer);
     }
+
+    if (ov_tokenizer && tokenization_cache_size > 0) {
+        init_tokenization_cache(tokenization_cache_size);
+    }
+    start_building_vocab_tables();
+}
+
+Tokenizer::TokenizerImpl::~TokenizerImpl() {
+    // the background task uses infer requests of this tokenizer
+    if (m_vocab_tables_future.valid()) {
+        m_vocab_tables_future.wait();
+    }
+}
+
+void Tokenizer::TokenizerImpl::start_building_vocab_tables() {
+    if (m_vocab.empty() || !m_ireq_queue_tokenizer || !m_ireq_queue_detokenizer || m_vocab_tables_future.valid()) {
+        return;
+    }
+    // decoding the whole vocabulary takes a while, so it is not done on the first request with stop strings
+    // or the first streamer: they use the detokenizer model till the tables are ready
+    m_vocab_tables_future = std::async(std::launch::async, [this] {
+        try {
+            get_decoded_vocab();
+            get_token_text_table();
+        } catch (const std::exception& e) {
+            GENAI_WARN(std::string("Failed to build the decoded vocabulary: ") + e.what());
+        }
+    });
+}
+
+bool Tokenizer::TokenizerImpl::are_vocab_tables_ready() const {
+    return !m_vocab_tables_future.valid() ||
+           m_vocab_tables_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void Tokenizer::TokenizerImpl::init_tokenization_cache(size_t max_num_tokens) {
+    if (m_older_than_24_5) {
+        // add_special_tokens can't be switched off to tokenize segments in the middle of the text
+        GENAI_WARN("Tokenization cache requires openvino_tokenizers 2024.5 or newer, the cache is disabled");
+        return;
+    }
+    if (!m_splittable_added_tokens) {
+        GENAI_WARN("Tokenization cache is disabled: tokenizer.json is not available or its normalizer or pre-tokenizer "
+                   "depends on where the text is split, e.g. adds a dummy prefix");
+        return;
+    }
+    auto tokenization_cache = std::make_unique<TokenizationCache>(max_num_tokens);
+
+    // special tokens are skipped by the detokenizer
+    auto decoded_vocab = get_decoded_vocab();
+    std::vector<std::pair<std::string, int64_t>> special_tokens;
+    for (size_t id = 0; id < decoded_vocab->size(); ++id) {
+        const auto& text = (*decoded_vocab)[id];
+        if (text && text->empty() && !m_vocab[id].empty()) {
+            if (!m_splittable_added_tokens->count(m_vocab[id])) {
+                GENAI_WARN("Tokenization cache is disabled: special token '" + m_vocab[id] +
+                           "' strips or normalizes the text around it");
+                return;
+            }
+            special_tokens.emplace_back(m_vocab[id], static_cast<int64_t>(id));
+        }
+    }
+    tokenization_cache->set_special_tokens(special_tokens);
+
+    auto to_vector = [](const ov::Tensor& input_ids) {
+        const int64_t* data = input_ids.data<int64_t>();
+        return std::vector<int64_t>(data, data + input_ids.get_size());
+    };
+    const std::string probe = "Hello";
+    const auto with_special_tokens = to_vector(infer_tokenizer(probe, {ov::genai::add_special_tokens(true)}).input_ids);
+    const auto text_tokens = to_vector(infer_tokenizer(probe, {ov::genai::add_special_tokens(false)}).input_ids);
+    auto text_begin = std::search(with_special_tokens.begin(), with_special_tokens.end(), text_tokens.begin(), text_tokens.end());
+    if (!text_tokens.empty() && text_begin != with_special_tokens.end()) {
+        m_special_tokens_around_text = std::make_pair(std::vector<int64_t>(with_special_tokens.begin(), text_begin),
+                                                      std::vector<int64_t>(text_begin + text_tokens.size(), with_special_tokens.end()));
+    }
+    m_tokenization_cache = std::move(tokenization_cache);
 }
 
 // load special tokens ids from config.json
@@ -536,6 +620,22 @@ void Tokenizer::TokenizerImpl::read_special_tokens_map(const std::filesystem::pa
     read_token_content_str(eos_token_key_name, m_eos_token);
 }
 
+// Reads added tokens the text can be split at by the tokenization cache from tokenizer.json.
+// The cache stays disabled if the file is not available.
+void Tokenizer::TokenizerImpl::read_splittable_added_tokens(const std::filesystem::path& tokenizer_path) {
+    auto tokenizer_json_path = tokenizer_path / "tokenizer.json";
+    if (!std::filesystem::exists(tokenizer_json_path))
+        return;
+    nlohmann::json tokenizer_json = nlohmann::json::parse(std::ifstream{tokenizer_json_path});
+
+    nlohmann::json tokenizer_config = nlohmann::json::object();
+    auto tokenizer_config_file_path = tokenizer_path / "tokenizer_config.json";
+    if (std::filesystem::exists(tokenizer_config_file_path)) {
+        tokenizer_config = nlohmann::json::parse(std::ifstream{tokenizer_config_file_path});
+    }
+    m_splittable_added_tokens = get_splittable_added_tokens(tokenizer_json, tokenizer_config);
+}
+
 // Read string representation of special tokens if they exist.
 // Also tries to load special token ids from added_tokens_decoder if they exist.
 // Will not override special token strings or ids if they already exist.
@@ -625,6 +725,66 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::string& prompt, cons
     OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                             "Tokenizer::encode is not available");
 
+    // max_length and padding are applied to the whole text by the tokenizer model
+    const bool is_cacheable = std::all_of(tokenization_params.begin(), tokenization_params.end(), [](const auto& param) {
+        return param.first == ov::genai::add_special_tokens.name();
+    });
+    if (m_tokenization_cache && m_is_tokenization_cache_valid && is_cacheable) {
+        bool add_special_tokens_flag = true;
+        ov::genai::utils::read_anymap_param(tokenization_params, ov::genai::add_special_tokens.name(), add_special_tokens_flag);
+        if (auto result = encode_with_cache(prompt, add_special_tokens_flag)) {
+            return *result;
+        }
+    }
+    return infer_tokenizer(prompt, tokenization_params);
+}
+
+std::optional<TokenizedInputs> Tokenizer::TokenizerImpl::encode_with_cache(const std::string& prompt, bool add_special_tokens_flag) {
+    if (add_special_tokens_flag && !m_special_tokens_around_text) {
+        return std::nullopt;
+    }
+    std::vector<int64_t> token_ids;
+    if (add_special_tokens_flag) {
+        token_ids = m_special_tokens_around_text->first;
+    }
+    for (const auto& segment : m_tokenization_cache->split(prompt)) {
+        if (segment.special_token_id != -1) {
+            token_ids.push_back(segment.special_token_id);
+            continue;
+        }
+        if (m_tokenization_cache->append_cached(segment.text, token_ids)) {
+            continue;
+        }
+        const ov::Tensor segment_tensor = infer_tokenizer(std::string(segment.text), {ov::genai::add_special_tokens(false)}).input_ids;
+        std::vector<int64_t> segment_ids(segment_tensor.data<int64_t>(), segment_tensor.data<int64_t>() + segment_tensor.get_size());
+        token_ids.insert(token_ids.end(), segment_ids.begin(), segment_ids.end());
+        m_tokenization_cache->put(segment.text, std::move(segment_ids));
+    }
+    if (add_special_tokens_flag) {
+        token_ids.insert(token_ids.end(), m_special_tokens_around_text->second.begin(), m_special_tokens_around_text->second.end());
+    }
+
+    // Splitting is allowed by tokenizer.json, see get_splittable_added_tokens(), the first encodings are additionally
+    // checked against the tokenizer model in case it was converted with different options.
+    if (m_num_verified_cached_encodings.fetch_add(1) < NUM_VERIFIED_CACHED_ENCODINGS) {
+        TokenizedInputs expected = infer_tokenizer(prompt, {ov::genai::add_special_tokens(add_special_tokens_flag)});
+        const int64_t* expected_ids = expected.input_ids.data<int64_t>();
+        if (!std::equal(token_ids.begin(), token_ids.end(), expected_ids, expected_ids + expected.input_ids.get_size())) {
+            GENAI_WARN("Tokenization cache is disabled: splitting the text by special tokens changes its tokenization");
+            m_is_tokenization_cache_valid = false;
+            m_tokenization_cache->clear();
+            return expected;
+        }
+    }
+
+    ov::Tensor input_ids{ov::element::i64, {1, token_ids.size()}};
+    std::copy(token_ids.begin(), token_ids.end(), input_ids.data<int64_t>());
+    ov::Tensor attention_mask{ov::element::i64, {1, token_ids.size()}};
+    std::fill_n(attention_mask.data<int64_t>(), token_ids.size(), 1);
+    return TokenizedInputs{input_ids, attention_mask};
+}
+
+TokenizedInputs Tokenizer::TokenizerImpl::infer_tokenizer(const std::string& prompt, const ov::AnyMap& tokenization_params) {
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
     set_state_if_necessary(infer_request_guard, tokenization_params);
     size_t batch_size = 1;
@@ -787,6 +947,116 @@ std::vector<std::string> Tokenizer::TokenizerImpl::decode(const std::vector<std:
     return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
 }
 
+std::shared_ptr<const std::vector<std::optional<std::string>>> Tokenizer::TokenizerImpl::get_decoded_vocab() {
+    std::call_once(m_decoded_vocab_flag, [this] {
+        auto decoded_vocab = std::make_shared<std::vector<std::optional<std::string>>>();
+        if (m_vocab.empty() || !m_ireq_queue_tokenizer || !m_ireq_queue_detokenizer) {
+            m_decoded_vocab = decoded_vocab;
+            return;
+        }
+        // Decoders often strip the leading space of the first token, so every token is decoded after an anchor
+        // token and the anchor text is cut off: this gives the text the token adds in the middle of a sequence.
+        auto anchor_ids = infer_tokenizer("a", {ov::genai::add_special_tokens(false)}).input_ids;
+        if (anchor_ids.get_size() == 0) {
+            m_decoded_vocab = decoded_vocab;
+            return;
+        }
+        const int64_t anchor = anchor_ids.data<int64_t>()[0];
+        const std::string anchor_text = decode(std::vector<int64_t>{anchor});
+        const std::string replacement_character = "\xEF\xBF\xBD";
+
+        const size_t vocab_size = m_vocab.size();
+        const size_t batch_size = 1024;
+        decoded_vocab->resize(vocab_size);
+        for (size_t begin = 0; begin < vocab_size; begin += batch_size) {
+            const size_t end = std::min(vocab_size, begin + batch_size);
+            // all lines have the same length, so no padding is needed
+            ov::Tensor tokens{ov::element::i64, {end - begin, 2}};
+            auto tokens_data = tokens.data<int64_t>();
+            for (size_t id = begin; id < end; ++id) {
+                tokens_data[(id - begin) * 2] = anchor;
+                tokens_data[(id - begin) * 2 + 1] = static_cast<int64_t>(id);
+            }
+            auto texts = decode(tokens);
+            for (size_t id = begin; id < end; ++id) {
+                const std::string& text = texts[id - begin];
+                if (text.compare(0, anchor_text.size(), anchor_text) != 0 ||
+                    text.find(replacement_character, anchor_text.size()) != std::string::npos) {
+                    continue;
+                }
+                (*decoded_vocab)[id] = text.substr(anchor_text.size());
+            }
+        }
+        m_decoded_vocab = decoded_vocab;
+    });
+    return m_decoded_vocab;
+}
+
+std::shared_ptr<const std::vector<std::optional<std::string>>> Tokenizer::TokenizerImpl::get_decoded_vocab_if_ready() {
+    return are_vocab_tables_ready() ? get_decoded_vocab() : nullptr;
+}
+
+std::shared_ptr<const TokenTextTable> Tokenizer::TokenizerImpl::get_token_text_table_if_ready() {
+    return are_vocab_tables_ready() ? get_token_text_table() : nullptr;
+}
+
+std::shared_ptr<const TokenTextTable> Tokenizer::TokenizerImpl::get_token_text_table() {
+    std::call_once(m_token_text_table_flag, [this] {
+        auto decoded_vocab = get_decoded_vocab();
+        if (decoded_vocab->empty()) {
+            return;
+        }
+        // SentencePiece vocabularies spell bytes as "<0xXX>", byte-level BPE ones map them to printable characters
+        const bool is_sentencepiece = std::find(m_vocab.begin(), m_vocab.end(), "<0x0A>") != m_vocab.end();
+        auto table = std::make_shared<TokenTextTable>();
+        table->m_token_bytes.resize(m_vocab.size());
+        for (size_t id = 0; id < m_vocab.size(); ++id) {
+            const auto& text = (*decoded_vocab)[id];
+            if (text) {
+                table->m_token_bytes[id] = *text;
+            } else {
+                table->m_token_bytes[id] = is_sentencepiece ? sentencepiece_token_bytes(m_vocab[id]) : byte_level_token_bytes(m_vocab[id]);
+            }
+        }
+
+        // the first token decoded alone shows whether the decoder strips the leading space
+        for (size_t id = 0; id < m_vocab.size(); ++id) {
+            const std::string& bytes = table->m_token_bytes[id];
+            if (bytes.size() > 1 && bytes.front() == ' ' && bytes[1] != ' ' && (*decoded_vocab)[id]) {
+                table->m_strip_leading_space = decode(std::vector<int64_t>{static_cast<int64_t>(id)}) == bytes.substr(1);
+                break;
+            }
+        }
+
+        // cleanup of spaces around punctuation, whitespace handling and multi-byte characters split across tokens
+        const std::vector<std::string> probes = {
+            "Hello, world! It's a test: don't stop (1 + 2 = 3)?",
+            " Leading space,  double  spaces\tand\ttabs\nnew line ... \"quotes\"",
+            "Привет, мир! 你好，世界 🙂👍 café",
+        };
+        for (const auto& probe : probes) {
+            for (bool add_special_tokens : {true, false}) {
+                const ov::Tensor ids = infer_tokenizer(probe, {ov::genai::add_special_tokens(add_special_tokens)}).input_ids;
+                const std::vector<int64_t> tokens(ids.data<int64_t>(), ids.data<int64_t>() + ids.get_size());
+                IncrementalDetokenizer detokenizer(table);
+                std::string text;
+                for (int64_t token : tokens) {
+                    if (token < 0 || static_cast<size_t>(token) >= table->m_token_bytes.size()) {
+                        return;
+                    }
+                    text += detokenizer.write(token);
+                }
+                text += detokenizer.end();
+                if (text != decode(tokens)) {
+                    return;
+                }
+            }
+        }
+        m_token_text_table = table;
+    });
+    return m_token_text_table;
+}
+
 std::string Tokenizer::TokenizerImpl::apply_chat_template(
     const ChatHistory& history,
     bool add_generation_prompt,
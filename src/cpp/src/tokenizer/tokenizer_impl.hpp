@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include "minja/minja.hpp"
 #include "minja/chat-template.hpp"
@@ -14,7 +18,9 @@
 
 #include "gguf_utils/gguf_tokenizer.hpp"
 #include "tokenizer/chat_template_fallback_map.hpp"
+#include "tokenizer/incremental_detokenizer.hpp"
 #include "tokenizer/make_tokenizer_stateful.hpp"
+#include "tokenizer/tokenization_cache.hpp"
 #include "tokenizer/tokenizers_path.hpp"
 #include "circular_buffer_queue.hpp"
 #include "json_utils.hpp"
@@ -45,6 +51,23 @@ public:
     std::string m_original_chat_template = {};
     std::vector<std::string> m_vocab = {};
     std::shared_ptr<StructuredOutputController> m_structured_output_controller = nullptr;
+    // text of each token decoded in isolation, built by get_decoded_vocab()
+    std::shared_ptr<const std::vector<std::optional<std::string>>> m_decoded_vocab = nullptr;
+    std::once_flag m_decoded_vocab_flag;
+    // built by get_token_text_table(), nullptr if native decoding doesn't match the detokenizer model
+    std::shared_ptr<const TokenTextTable> m_token_text_table = nullptr;
+    std::once_flag m_token_text_table_flag;
+    // builds the decoded vocabulary and the token text table in background after the tokenizer is set up
+    std::future<void> m_vocab_tables_future;
+    // enabled by tokenization_cache_size property, see encode_with_cache()
+    std::unique_ptr<TokenizationCache> m_tokenization_cache = nullptr;
+    // ids add_special_tokens puts before and after the text, std::nullopt if they can't be separated from the text
+    std::optional<std::pair<std::vector<int64_t>, std::vector<int64_t>>> m_special_tokens_around_text = std::nullopt;
+    // added tokens from tokenizer.json the text can be split at, std::nullopt disables the tokenization cache
+    std::optional<std::unordered_set<std::string>> m_splittable_added_tokens = std::nullopt;
+    // the first encodings with the cache are compared with the tokenizer model
+    std::atomic<size_t> m_num_verified_cached_encodings = 0;
+    std::atomic<bool> m_is_tokenization_cache_valid = true;
 
     template <typename T>
     void set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags);
@@ -53,6 +76,7 @@ public:
 
     TokenizerImpl(const std::filesystem::path& models_path, const ov::AnyMap& properties);
     TokenizerImpl(const std::pair<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>>& models, const ov::AnyMap& properties);
+    ~TokenizerImpl();
 
     void setup_tokenizer(const std::filesystem::path& models_path, const ov::AnyMap& properties);
     void setup_tokenizer(const std::pair<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>>& models, ov::AnyMap properties);
@@ -60,6 +84,7 @@ public:
     void read_config(const std::filesystem::path& tokenizer_path);
     void read_special_tokens_map(const std::filesystem::path& tokenizer_path);
     void read_tokenizer_config_if_necessary(const std::filesystem::path& tokenizer_path);
+    void read_splittable_added_tokens(const std::filesystem::path& tokenizer_path);
     void infer_special_tokens_if_necessary();
 
     TokenizedInputs encode(const std::string& prompt, const ov::AnyMap& tokenization_params = {});
@@ -69,6 +94,15 @@ public:
 
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask);
 
+    // runs the tokenizer model for a single prompt
+    TokenizedInputs infer_tokenizer(const std::string& prompt, const ov::AnyMap& tokenization_params);
+    void init_tokenization_cache(size_t max_num_tokens);
+    /**
+     * @brief Encodes the prompt split by special tokens, text segments are taken from m_tokenization_cache when possible.
+     * @return std::nullopt if the prompt can't be encoded with the cache.
+     */
+    std::optional<TokenizedInputs> encode_with_cache(const std::string& prompt, bool add_special_tokens);
+
     std::string decode(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params = {});
     std::vector<std::string> decode(const ov::Tensor& tokens, const ov::AnyMap& detokenization_params = {});
     std::vector<std::string> decode(const std::vector<std::vector<int64_t>>& lines, const ov::AnyMap& detokenization_params = {});
@@ -83,6 +117,34 @@ public:
     std::string get_chat_template() const;
     std::string get_original_chat_template() const;
     std::shared_ptr<StructuredOutputController> get_structured_output_controller(std::optional<int> vocab_size = std::nullopt);
+
+    /**
+     * @brief Returns the text each token contributes when it follows another token, decoded once for the whole
+     * vocabulary. Entries are std::nullopt for tokens which don't decode to complete text on their own (e.g. byte
+     * fallback tokens holding a part of a UTF-8 character). Empty if the vocabulary is not available.
+     */
+    std::shared_ptr<const std::vector<std::optional<std::string>>> get_decoded_vocab();
+
+    /**
+     * @brief Returns the bytes of each token for IncrementalDetokenizer which reproduces the detokenizer model with
+     * default detokenization parameters. Tokens with complete text take it from get_decoded_vocab(), the rest are
+     * byte-level BPE or SentencePiece byte fallback entries of the vocabulary. The table is checked against the
+     * detokenizer model on probe texts and nullptr is returned if they don't match.
+     */
+    std::shared_ptr<const TokenTextTable> get_token_text_table();
+
+    /**
+     * @brief Returns get_decoded_vocab() if it is already built, nullptr while it is being built in background.
+     */
+    std::shared_ptr<const std::vector<std::optional<std::string>>> get_decoded_vocab_if_ready();
+
+    /**
+     * @brief Returns get_token_text_table() if it is already built, nullptr while it is being built in background.
+     */
+    std::shared_ptr<const TokenTextTable> get_token_text_table_if_ready();
+
+    void start_building_vocab_tables();
+    bool are_vocab_tables_ready() const;
 };
 
 }  // namespace genai
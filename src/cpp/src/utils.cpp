@@ -3,11 +3,13 @@
 
 #include "utils.hpp"
 
+#include <algorithm>
 #include <variant>
 #include <fstream>
 #include <memory>
 
 #include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/gather.hpp"
 #include "openvino/op/multiply.hpp"
@@ -186,6 +188,22 @@ void initialize_position_ids(ov::Tensor& position_ids, const ov::Tensor& attenti
     }
 }
 
+std::vector<std::pair<size_t, size_t>> get_token_spans(const ov::Tensor& attention_mask) {
+    OPENVINO_ASSERT(attention_mask.get_element_type() == ov::element::i64,
+                    "attention_mask tensor element type should be an i64");
+    const size_t batch_size = attention_mask.get_shape()[0];
+    const size_t seq_length = attention_mask.get_shape()[1];
+    const int64_t* attention_mask_data = attention_mask.data<int64_t>();
+
+    std::vector<std::pair<size_t, size_t>> spans(batch_size);
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        const int64_t* row = attention_mask_data + batch * seq_length;
+        const size_t offset = std::find(row, row + seq_length, 1) - row;
+        spans[batch] = {offset, static_cast<size_t>(std::count(row, row + seq_length, 1))};
+    }
+    return spans;
+}
+
 ov::genai::StreamerVariant get_streamer_from_map(const ov::AnyMap& config_map) {
     ov::genai::StreamerVariant streamer = std::monostate();
 
@@ -1027,6 +1045,116 @@ ov::Tensor make_tensor_slice(const ov::Tensor& tensor, size_t dim, size_t start_
     return ov::Tensor(tensor, start_shape, end_shape);
 }
 
+namespace {
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t xxh_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+template <typename T>
+inline T xxh_read_le(const uint8_t* ptr) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(ptr[i]) << (8 * i);
+    }
+    return value;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = xxh_rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+inline uint64_t xxh_merge_round(uint64_t acc, uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+}  // namespace
+
+uint64_t stable_hash(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = ptr + size;
+    uint64_t h64;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+        do {
+            v1 = xxh_round(v1, xxh_read_le<uint64_t>(ptr));
+            v2 = xxh_round(v2, xxh_read_le<uint64_t>(ptr + 8));
+            v3 = xxh_round(v3, xxh_read_le<uint64_t>(ptr + 16));
+            v4 = xxh_round(v4, xxh_read_le<uint64_t>(ptr + 24));
+            ptr += 32;
+        } while (ptr <= limit);
+
+        h64 = xxh_rotl64(v1, 1) + xxh_rotl64(v2, 7) + xxh_rotl64(v3, 12) + xxh_rotl64(v4, 18);
+        h64 = xxh_merge_round(h64, v1);
+        h64 = xxh_merge_round(h64, v2);
+        h64 = xxh_merge_round(h64, v3);
+        h64 = xxh_merge_round(h64, v4);
+    } else {
+        h64 = seed + XXH_PRIME64_5;
+    }
+
+    h64 += static_cast<uint64_t>(size);
+
+    for (; ptr + 8 <= end; ptr += 8) {
+        h64 ^= xxh_round(0, xxh_read_le<uint64_t>(ptr));
+        h64 = xxh_rotl64(h64, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (ptr + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(xxh_read_le<uint32_t>(ptr)) * XXH_PRIME64_1;
+        h64 = xxh_rotl64(h64, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        ptr += 4;
+    }
+    for (; ptr < end; ++ptr) {
+        h64 ^= static_cast<uint64_t>(*ptr) * XXH_PRIME64_5;
+        h64 = xxh_rotl64(h64, 11) * XXH_PRIME64_1;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= XXH_PRIME64_2;
+    h64 ^= h64 >> 29;
+    h64 *= XXH_PRIME64_3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
+uint64_t get_model_fingerprint(const std::shared_ptr<const ov::Model>& model) {
+    // hashing all weights of a multi-GB model takes seconds, so large constants are sampled
+    constexpr size_t num_samples = 16;
+    constexpr size_t sample_size = 64;
+    uint64_t fingerprint = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        const std::string op_type = op->get_type_info().name;
+        fingerprint = stable_hash(op_type.data(), op_type.size(), fingerprint);
+        if (const auto constant = ov::as_type_ptr<const ov::op::v0::Constant>(op)) {
+            const std::string layout = constant->get_element_type().get_type_name() + constant->get_shape().to_string();
+            fingerprint = stable_hash(layout.data(), layout.size(), fingerprint);
+            const auto data = static_cast<const uint8_t*>(constant->get_data_ptr());
+            const size_t byte_size = constant->get_byte_size();
+            if (byte_size <= num_samples * sample_size) {
+                fingerprint = stable_hash(data, byte_size, fingerprint);
+                continue;
+            }
+            for (size_t i = 0; i < num_samples; ++i) {
+                const size_t offset = i * (byte_size - sample_size) / (num_samples - 1);
+                fingerprint = stable_hash(data + offset, sample_size, fingerprint);
+            }
+        }
+    }
+    return fingerprint;
+}
+
 ov::genai::GenerationConfig get_beam_search_config() {
     ov::genai::GenerationConfig beam_search_config;
     beam_search_config.num_beams = 4;
@@ -83,6 +83,11 @@ Tensor init_attention_mask(const Tensor& position_ids);
 
 void initialize_position_ids(ov::Tensor& position_ids, const ov::Tensor& attention_mask, int64_t start_pos = 0);
 
+/**
+ * @brief Returns [offset, length] of unpadded tokens of each row of [batch_size, seq_len] attention mask.
+ */
+std::vector<std::pair<size_t, size_t>> get_token_spans(const ov::Tensor& attention_mask);
+
 template <typename T> struct OmitOptional { using value = T; };
 template <typename T> struct OmitOptional<std::optional<T>> { using value = T; };
 
@@ -409,6 +414,23 @@ std::pair<ov::Coordinate, ov::Coordinate> make_roi(const std::vector<size_t>& sh
  */
 ov::Tensor make_tensor_slice(const ov::Tensor& tensor, size_t dim, size_t start_pos, size_t end_pos);
 
+/**
+ * @brief Computes a 64-bit XXH64 hash of a byte range.
+ *
+ * Unlike std::hash, the result does not depend on the standard library implementation or the process,
+ * so it can be used as a key for data persisted between pipeline runs (e.g. spilled KV-cache blocks).
+ * Input is interpreted as a little-endian byte stream.
+ */
+uint64_t stable_hash(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief Computes a process-independent identity of a model: a stable_hash of its operation types,
+ * and element types, shapes and contents of all its constants (weights). Contents of large constants are
+ * sampled at evenly spaced offsets, so the cost doesn't grow with the model size.
+ * Data persisted for one model (e.g. spilled KV-cache blocks) must not be reused with another one.
+ */
+uint64_t get_model_fingerprint(const std::shared_ptr<const ov::Model>& model);
+
 ov::genai::GenerationConfig get_beam_search_config();
 ov::genai::GenerationConfig get_greedy_config();
 ov::genai::GenerationConfig get_multinomial_config();
@@ -292,6 +292,16 @@ export type AssistingGenerationConfig = {
    * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
    * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
   max_ngram_size?: Uint;
+  /** the number of candidate chains proposed by draft model. Chains start with the draft model's top tokens, are
+   * validated by main model in a single inference and the longest accepted one is kept. Values > 1 are supported only
+   * by speculative decoding with greedy decoding.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  num_assistant_branches?: Uint;
+  /** if true, the number of candidates is chosen each iteration within [0, num_assistant_tokens] based on the recent
+   * acceptance rate and measured draft / main model latencies. Supported only by speculative decoding with draft model. */
+  adaptive_num_assistant_tokens?: boolean;
   /** whether to apply chat_template for non-chat scenarios */
   apply_chat_template?: boolean;
 };
@@ -303,6 +313,27 @@ export type CDPrunerGenerationConfig = {
   relevance_weight?: number;
 };
 
+export type SchedulingGenerationConfig = {
+  /** the priority class of the request, used by ContinuousBatching backend only. Requests of a higher class are
+   * scheduled first and preempted last; new requests of lower classes are not admitted while requests of a higher
+   * class are missing their latency targets.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  priority?: Uint;
+  /** time to first token target in milliseconds, 0 means no target. Within a priority class, requests closer to
+   * missing their target are scheduled first.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  ttft_target_ms?: Uint;
+  /** time per output token target in milliseconds, 0 means no target.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  tpot_target_ms?: Uint;
+};
+
 export type GenericGenerationConfig = {
   // adapters?: AdapterConfig | None
   /** if set to true, the model will echo the prompt in the output. */
@@ -367,6 +398,7 @@ export type GenerationConfig = GenericGenerationConfig &
   RandomSamplingsGenerationConfig &
   CDPrunerGenerationConfig &
   AssistingGenerationConfig &
+  SchedulingGenerationConfig &
   StructuredOutputGenerationConfig &
   ParserGenerationConfig;
 
@@ -1333,6 +1333,13 @@ Napi::Value cpp_to_js<ov::genai::GenerationConfig, Napi::Value>(const Napi::Env&
             cpp_to_js<float, Napi::Value>(env, config.assistant_confidence_threshold));
     obj.Set("num_assistant_tokens", cpp_to_js<size_t, Napi::Value>(env, config.num_assistant_tokens));
     obj.Set("max_ngram_size", cpp_to_js<size_t, Napi::Value>(env, config.max_ngram_size));
+    obj.Set("num_assistant_branches", cpp_to_js<size_t, Napi::Value>(env, config.num_assistant_branches));
+    obj.Set("adaptive_num_assistant_tokens", Napi::Boolean::New(env, config.adaptive_num_assistant_tokens));
+
+    // Scheduling parameters
+    obj.Set("priority", cpp_to_js<size_t, Napi::Value>(env, config.priority));
+    obj.Set("ttft_target_ms", cpp_to_js<size_t, Napi::Value>(env, config.ttft_target_ms));
+    obj.Set("tpot_target_ms", cpp_to_js<size_t, Napi::Value>(env, config.tpot_target_ms));
 
     // Structured output parameters
     if (config.structured_output_config.has_value()) {
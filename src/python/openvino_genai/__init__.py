@@ -66,7 +66,7 @@ from .py_openvino_genai import (
 from .py_openvino_genai import ChatHistory
 
 # Tokenizers
-from .py_openvino_genai import TokenizedInputs, Tokenizer
+from .py_openvino_genai import TokenizationCacheStats, TokenizedInputs, Tokenizer
 
 # Whisper
 from .py_openvino_genai import (
@@ -116,6 +116,7 @@ from .py_openvino_genai import (
     GenerationResult,
     GenerationStatus,
     SchedulerConfig,
+    PreemptionMode,
     CacheEvictionConfig,
     AggregationMode,
     SparseAttentionMode,
@@ -602,9 +602,15 @@ class ContinuousBatchingPipeline:
     def generate(self, input_ids: collections.abc.Sequence[openvino._pyopenvino.Tensor], generation_config: collections.abc.Sequence[GenerationConfig], streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None) -> list[EncodedGenerationResult]:
         ...
     @typing.overload
+    def generate(self, input_ids: collections.abc.Sequence[openvino._pyopenvino.Tensor], generation_config: collections.abc.Sequence[GenerationConfig], streamers: collections.abc.Sequence[collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None]) -> list[EncodedGenerationResult]:
+        ...
+    @typing.overload
     def generate(self, prompts: collections.abc.Sequence[str], generation_config: collections.abc.Sequence[GenerationConfig], streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None) -> list[GenerationResult]:
         ...
     @typing.overload
+    def generate(self, prompts: collections.abc.Sequence[str], generation_config: collections.abc.Sequence[GenerationConfig], streamers: collections.abc.Sequence[collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None]) -> list[GenerationResult]:
+        ...
+    @typing.overload
     def generate(self, prompt: str, generation_config: GenerationConfig, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None) -> list[GenerationResult]:
         ...
     @typing.overload
@@ -963,8 +969,16 @@ class GenerationConfig:
         top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
         do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
         num_return_sequences: the number of sequences to generate from a single prompt.
+    
+        Scheduling parameters (ContinuousBatching backend only):
+        priority:       the priority class of the request. Requests of a higher class are scheduled first and preempted last;
+                        new requests of lower classes are not admitted while requests of a higher class are missing their latency targets.
+        ttft_target_ms: time to first token target in milliseconds, 0 means no target. Within a priority class,
+                        requests closer to missing their target are scheduled first.
+        tpot_target_ms: time per output token target in milliseconds, 0 means no target.
     """
     adapters: openvino_genai.py_openvino_genai.AdapterConfig | None
+    adaptive_num_assistant_tokens: bool
     apply_chat_template: bool
     do_sample: bool
     echo: bool
@@ -1063,6 +1077,12 @@ class GenerationConfig:
     def no_repeat_ngram_size(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def num_assistant_branches(self) -> int:
+        ...
+    @num_assistant_branches.setter
+    def num_assistant_branches(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def num_assistant_tokens(self) -> int:
         ...
     @num_assistant_tokens.setter
@@ -1099,6 +1119,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def pruning_ratio(self) -> int:
         ...
     @pruning_ratio.setter
@@ -1152,6 +1178,18 @@ class GenerationConfig:
     @top_p.setter
     def top_p(self, arg0: typing.SupportsFloat) -> None:
         ...
+    @property
+    def tpot_target_ms(self) -> int:
+        ...
+    @tpot_target_ms.setter
+    def tpot_target_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def ttft_target_ms(self) -> int:
+        ...
+    @ttft_target_ms.setter
+    def ttft_target_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
 class GenerationFinishReason:
     """
     Members:
@@ -1841,6 +1879,13 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (ContinuousBatching backend only):
+            priority:       the priority class of the request. Requests of a higher class are scheduled first and preempted last;
+                            new requests of lower classes are not admitted while requests of a higher class are missing their latency targets.
+            ttft_target_ms: time to first token target in milliseconds, 0 means no target. Within a priority class,
+                            requests closer to missing their target are scheduled first.
+            tpot_target_ms: time per output token target in milliseconds, 0 means no target.
         """
     @typing.overload
     def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
@@ -1938,6 +1983,13 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (ContinuousBatching backend only):
+            priority:       the priority class of the request. Requests of a higher class are scheduled first and preempted last;
+                            new requests of lower classes are not admitted while requests of a higher class are missing their latency targets.
+            ttft_target_ms: time to first token target in milliseconds, 0 means no target. Within a priority class,
+                            requests closer to missing their target are scheduled first.
+            tpot_target_ms: time per output token target in milliseconds, 0 means no target.
         """
     def get_generation_config(self) -> GenerationConfig:
         ...
@@ -2167,6 +2219,12 @@ class PipelineMetrics:
         :param scheduled_requests:  Number of requests that were scheduled for processing at the previous step of the pipeline.
         :type scheduled_requests: int
     
+        :param scheduled_tokens: Number of tokens that were scheduled for processing at the previous step of the pipeline.
+        :type scheduled_tokens: int
+    
+        :param preempted_requests: Number of requests that were preempted to free KV cache blocks at the previous step of the pipeline.
+        :type preempted_requests: int
+    
         :param cache_usage: Percentage of KV cache usage in the last generation step.
         :type cache_usage: float
     
@@ -2196,11 +2254,59 @@ class PipelineMetrics:
     def max_cache_usage(self) -> float:
         ...
     @property
+    def preempted_requests(self) -> int:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
     def scheduled_requests(self) -> int:
         ...
+    @property
+    def scheduled_tokens(self) -> int:
+        ...
+class PreemptionMode:
+    """
+    Represents the way running sequence groups are preempted when there are not enough KV-cache blocks.
+                                   :param PreemptionMode.RECOMPUTE: KV-blocks are released, the prompt and the generated tokens are processed again later.
+                                   :param PreemptionMode.SWAP: KV-blocks are copied to a host memory pool and copied back later. Supported for KV-cache in host memory (CPU).
+    
+    
+    Members:
+    
+      RECOMPUTE
+    
+      SWAP
+    """
+    RECOMPUTE: typing.ClassVar[PreemptionMode]  # value = <PreemptionMode.RECOMPUTE: 0>
+    SWAP: typing.ClassVar[PreemptionMode]  # value = <PreemptionMode.SWAP: 1>
+    __members__: typing.ClassVar[dict[str, PreemptionMode]]  # value = {'RECOMPUTE': <PreemptionMode.RECOMPUTE: 0>, 'SWAP': <PreemptionMode.SWAP: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class RawImageGenerationPerfMetrics:
     """
     
@@ -2503,6 +2609,15 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        prefix_cache_spill_path:    Path to a file used as a persistent second-tier prefix cache (CPU only).
+            KV-blocks overwritten in memory are written to this file and restored from it for matching prefixes,
+            also after restart. Requires enable_prefix_caching and cache_size or num_kv_blocks. Empty string disables it.
+        prefix_cache_spill_size:    Maximum size of the prefix cache spill file in GB.
+        preemption_mode:            How running sequence groups are preempted when KV-cache is exhausted.
+            PreemptionMode.SWAP copies KV-blocks to host memory and back instead of recomputing them (CPU only).
+        swap_space_size:            Size of the host memory pool for swapped out KV-blocks in GB.
+        swap_min_num_tokens:        Minimal number of processed tokens for a sequence group to be swapped out
+            instead of recomputed.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
@@ -2511,6 +2626,8 @@ class SchedulerConfig:
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    preemption_mode: PreemptionMode
+    prefix_cache_spill_path: str
     sparse_attention_config: SparseAttentionConfig
     use_cache_eviction: bool
     use_sparse_attention: bool
@@ -2542,6 +2659,24 @@ class SchedulerConfig:
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def prefix_cache_spill_size(self) -> int:
+        ...
+    @prefix_cache_spill_size.setter
+    def prefix_cache_spill_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_min_num_tokens(self) -> int:
+        ...
+    @swap_min_num_tokens.setter
+    def swap_min_num_tokens(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_space_size(self) -> int:
+        ...
+    @swap_space_size.setter
+    def swap_space_size(self, arg0: typing.SupportsInt) -> None:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -3549,12 +3684,20 @@ class TextEmbeddingPipeline:
             batch_size (int, optional):
                 Batch size for the embedding model.
                 Useful for database population. If set, the pipeline will fix model shape for inference optimization.
-                Number of documents passed to pipeline should be equal to batch_size.
+                Documents are embedded in batches of batch_size, the last batch is filled up with repeated documents.
                 For query embeddings, batch_size should be set to 1 or not set.
+            max_batch_tokens (int, optional):
+                Maximum number of tokens, including padding, in a batch if batch_size is not set. Defaults to 16384.
+                Documents are sorted by length and split into batches within the budget.
+                0 embeds all documents in one batch.
             pooling_type (TextEmbeddingPipeline.PoolingType, optional):
                 Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
             normalize (bool, optional):
                 If True, L2 normalization is applied to embeddings. Defaults to True.
+            embedding_dimensions (int, optional):
+                Number of the first embedding values to keep for Matryoshka models. Applied before normalization.
+            embedding_type (TextEmbeddingPipeline.EmbeddingType, optional):
+                Type of embeddings. INT8 and UBINARY embeddings are quantized by the model. Defaults to EmbeddingType.FLOAT.
             query_instruction (str, optional):
                 Instruction to use for embedding a query.
             embed_instruction (str, optional):
@@ -3563,6 +3706,7 @@ class TextEmbeddingPipeline:
                 Side to use for padding "left" or "right"
         """
         embed_instruction: str | None
+        embedding_type: TextEmbeddingPipeline.EmbeddingType
         normalize: bool
         pad_to_max_length: bool | None
         padding_side: str | None
@@ -3585,11 +3729,63 @@ class TextEmbeddingPipeline:
         def batch_size(self, arg0: typing.SupportsInt | None) -> None:
             ...
         @property
+        def embedding_dimensions(self) -> int | None:
+            ...
+        @embedding_dimensions.setter
+        def embedding_dimensions(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
+        def max_batch_tokens(self) -> int:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
         def max_length(self, arg0: typing.SupportsInt | None) -> None:
             ...
+    class EmbeddingType:
+        """
+        Members:
+        
+          FLOAT : f32 embeddings
+        
+          INT8 : Embeddings scaled by 127 / max(abs(embedding)) and rounded to int8
+        
+          UBINARY : Signs of embedding values packed into uint8 bits, the most significant bit first
+        """
+        FLOAT: typing.ClassVar[TextEmbeddingPipeline.EmbeddingType]  # value = <EmbeddingType.FLOAT: 0>
+        INT8: typing.ClassVar[TextEmbeddingPipeline.EmbeddingType]  # value = <EmbeddingType.INT8: 1>
+        UBINARY: typing.ClassVar[TextEmbeddingPipeline.EmbeddingType]  # value = <EmbeddingType.UBINARY: 2>
+        __members__: typing.ClassVar[dict[str, TextEmbeddingPipeline.EmbeddingType]]  # value = {'FLOAT': <EmbeddingType.FLOAT: 0>, 'INT8': <EmbeddingType.INT8: 1>, 'UBINARY': <EmbeddingType.UBINARY: 2>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
     class PoolingType:
         """
         Members:
@@ -3701,6 +3897,11 @@ class TextRerankPipeline:
                 If 'True', model input tensors are padded to the maximum length.
             padding_side (str, optional):
                 Side to use for padding "left" or "right"
+            max_batch_tokens (int, optional):
+                Maximum number of tokens, including padding, in a batch. Defaults to 16384.
+                Documents are sorted by length and split into batches within the budget.
+                For stateful decoder models, tokens shared by all query-document pairs are inferred once.
+                0 reranks all documents in one batch.
         """
         pad_to_max_length: bool | None
         padding_side: str | None
@@ -3711,6 +3912,12 @@ class TextRerankPipeline:
         def __init__(self, **kwargs) -> None:
             ...
         @property
+        def max_batch_tokens(self) -> int:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
@@ -3757,6 +3964,33 @@ class TextStreamer(StreamerBase):
         ...
     def write(self, token: typing.SupportsInt | collections.abc.Sequence[typing.SupportsInt]) -> StreamingStatus:
         ...
+class TokenizationCacheStats:
+    """
+    
+        Counters of the tokenization cache enabled by 'tokenization_cache_size' Tokenizer property.
+    
+        :param hits: Number of text segments taken from the cache.
+        :type hits: int
+    
+        :param misses: Number of text segments run through the tokenizer model.
+        :type misses: int
+    
+        :param num_cached_tokens: Number of token ids kept in the cache.
+        :type num_cached_tokens: int
+    """
+    def __init__(self) -> None:
+        ...
+    def get_hit_rate(self) -> float:
+        ...
+    @property
+    def hits(self) -> int:
+        ...
+    @property
+    def misses(self) -> int:
+        ...
+    @property
+    def num_cached_tokens(self) -> int:
+        ...
 class TokenizedInputs:
     attention_mask: openvino._pyopenvino.Tensor
     input_ids: openvino._pyopenvino.Tensor
@@ -3870,6 +4104,10 @@ class Tokenizer:
         ...
     def get_pad_token_id(self) -> int:
         ...
+    def get_tokenization_cache_stats(self) -> TokenizationCacheStats:
+        """
+        Returns counters of the tokenization cache, all zeros if 'tokenization_cache_size' property is not set or the cache is disabled.
+        """
     def get_vocab(self) -> dict:
         """
         Returns the vocabulary as a Python dictionary with bytes keys and integer values. 
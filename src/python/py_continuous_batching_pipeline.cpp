@@ -19,6 +19,7 @@ namespace py = pybind11;
 namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::AggregationMode;
+using ov::genai::PreemptionMode;
 using ov::genai::SparseAttentionMode;
 using ov::genai::CacheEvictionConfig;
 using ov::genai::SparseAttentionConfig;
@@ -122,6 +123,15 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    prefix_cache_spill_path:    Path to a file used as a persistent second-tier prefix cache (CPU only).
+        KV-blocks overwritten in memory are written to this file and restored from it for matching prefixes,
+        also after restart. Requires enable_prefix_caching and cache_size or num_kv_blocks. Empty string disables it.
+    prefix_cache_spill_size:    Maximum size of the prefix cache spill file in GB.
+    preemption_mode:            How running sequence groups are preempted when KV-cache is exhausted.
+        PreemptionMode.SWAP copies KV-blocks to host memory and back instead of recomputing them (CPU only).
+    swap_space_size:            Size of the host memory pool for swapped out KV-blocks in GB.
+    swap_min_num_tokens:        Minimal number of processed tokens for a sequence group to be swapped out
+        instead of recomputed.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -157,6 +167,12 @@ auto pipeline_metrics_docstring = R"(
     :param scheduled_requests:  Number of requests that were scheduled for processing at the previous step of the pipeline.
     :type scheduled_requests: int
 
+    :param scheduled_tokens: Number of tokens that were scheduled for processing at the previous step of the pipeline.
+    :type scheduled_tokens: int
+
+    :param preempted_requests: Number of requests that were preempted to free KV cache blocks at the previous step of the pipeline.
+    :type preempted_requests: int
+
     :param cache_usage: Percentage of KV cache usage in the last generation step.
     :type cache_usage: float
 
@@ -184,11 +200,11 @@ std::ostream& operator << (std::ostream& stream, const GenerationResult& generat
     return stream << std::endl;
 }
 
-py::object __call_cb_generate(ContinuousBatchingPipeline& pipe,
-                              const std::variant<std::vector<ov::Tensor>, std::vector<std::string>>& inputs,
-                              const std::vector<ov::genai::GenerationConfig>& sampling_params,
-                              const pyutils::PyBindStreamerVariant& py_streamer) {
-    ov::genai::StreamerVariant streamer = pyutils::pystreamer_to_streamer(py_streamer);
+template <typename Streamer>
+py::object __call_cb_generate_impl(ContinuousBatchingPipeline& pipe,
+                                   const std::variant<std::vector<ov::Tensor>, std::vector<std::string>>& inputs,
+                                   const std::vector<ov::genai::GenerationConfig>& sampling_params,
+                                   const Streamer& streamer) {
     py::object results;
 
     std::visit(pyutils::overloaded {
@@ -213,6 +229,26 @@ py::object __call_cb_generate(ContinuousBatchingPipeline& pipe,
     return results;
 }
 
+py::object __call_cb_generate(ContinuousBatchingPipeline& pipe,
+                              const std::variant<std::vector<ov::Tensor>, std::vector<std::string>>& inputs,
+                              const std::vector<ov::genai::GenerationConfig>& sampling_params,
+                              const pyutils::PyBindStreamerVariant& py_streamer) {
+    ov::genai::StreamerVariant streamer = pyutils::pystreamer_to_streamer(py_streamer);
+    return __call_cb_generate_impl(pipe, inputs, sampling_params, streamer);
+}
+
+py::object __call_cb_generate(ContinuousBatchingPipeline& pipe,
+                              const std::variant<std::vector<ov::Tensor>, std::vector<std::string>>& inputs,
+                              const std::vector<ov::genai::GenerationConfig>& sampling_params,
+                              const std::vector<pyutils::PyBindStreamerVariant>& py_streamers) {
+    std::vector<ov::genai::StreamerVariant> streamers;
+    streamers.reserve(py_streamers.size());
+    for (const auto& py_streamer : py_streamers) {
+        streamers.push_back(pyutils::pystreamer_to_streamer(py_streamer));
+    }
+    return __call_cb_generate_impl(pipe, inputs, sampling_params, streamers);
+}
+
 } // namespace
 
 void init_continuous_batching_pipeline(py::module_& m) {
@@ -346,6 +382,14 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def("to_string", &CacheEvictionConfig::to_string)
             .def_readwrite("adaptive_rkv_config", &CacheEvictionConfig::adaptive_rkv_config);
 
+    py::enum_<PreemptionMode>(m, "PreemptionMode",
+                            R"(Represents the way running sequence groups are preempted when there are not enough KV-cache blocks.
+                               :param PreemptionMode.RECOMPUTE: KV-blocks are released, the prompt and the generated tokens are processed again later.
+                               :param PreemptionMode.SWAP: KV-blocks are copied to a host memory pool and copied back later. Supported for KV-cache in host memory (CPU).
+)")
+            .value("RECOMPUTE", PreemptionMode::RECOMPUTE)
+            .value("SWAP", PreemptionMode::SWAP);
+
     py::enum_<SparseAttentionMode>(m, "SparseAttentionMode",
                             R"(Represents the mode of sparse attention applied during generation.
                                :param SparseAttentionMode.TRISHAPE: Sparse attention will be applied to prefill stage only, with a configurable number of start and recent cache tokens to be retained. A number of prefill tokens in the end of the prompt can be configured to have dense attention applied to them instead, to retain generation accuracy.
@@ -383,6 +427,11 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("prefix_cache_spill_path", &SchedulerConfig::prefix_cache_spill_path)
+        .def_readwrite("prefix_cache_spill_size", &SchedulerConfig::prefix_cache_spill_size)
+        .def_readwrite("preemption_mode", &SchedulerConfig::preemption_mode)
+        .def_readwrite("swap_space_size", &SchedulerConfig::swap_space_size)
+        .def_readwrite("swap_min_num_tokens", &SchedulerConfig::swap_min_num_tokens)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
@@ -393,6 +442,8 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
+            .def_readonly("scheduled_tokens", &PipelineMetrics::scheduled_tokens)
+            .def_readonly("preempted_requests", &PipelineMetrics::preempted_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
             .def_readonly("kv_cache_size_in_bytes", &PipelineMetrics::kv_cache_size_in_bytes)
@@ -468,6 +519,34 @@ void init_continuous_batching_pipeline(py::module_& m) {
             py::arg("streamer") = std::monostate{}
         )
 
+        .def(
+            "generate",
+            [](ContinuousBatchingPipeline& pipe,
+               const std::vector<ov::Tensor>& input_ids,
+               const std::vector<ov::genai::GenerationConfig>& generation_config,
+               const std::vector<pyutils::PyBindStreamerVariant>& streamers
+            ) -> py::typing::Union<std::vector<ov::genai::EncodedGenerationResult>> {
+                return __call_cb_generate(pipe, input_ids, generation_config, streamers);
+            },
+            py::arg("input_ids"),
+            py::arg("generation_config"),
+            py::arg("streamers")
+        )
+
+        .def(
+            "generate",
+            [](ContinuousBatchingPipeline& pipe,
+               const std::vector<std::string>& prompts,
+               const std::vector<ov::genai::GenerationConfig>& generation_config,
+               const std::vector<pyutils::PyBindStreamerVariant>& streamers
+            ) -> py::typing::Union<std::vector<ov::genai::GenerationResult>> {
+                return __call_cb_generate(pipe, prompts, generation_config, streamers);
+            },
+            py::arg("prompts"),
+            py::arg("generation_config"),
+            py::arg("streamers")
+        )
+
         .def(
             "generate",
             [](ContinuousBatchingPipeline& pipe,
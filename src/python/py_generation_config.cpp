@@ -193,6 +193,13 @@ char generation_config_docstring[] = R"(
     top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
     do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
     num_return_sequences: the number of sequences to generate from a single prompt.
+
+    Scheduling parameters (ContinuousBatching backend only):
+    priority:       the priority class of the request. Requests of a higher class are scheduled first and preempted last;
+                    new requests of lower classes are not admitted while requests of a higher class are missing their latency targets.
+    ttft_target_ms: time to first token target in milliseconds, 0 means no target. Within a priority class,
+                    requests closer to missing their target are scheduled first.
+    tpot_target_ms: time per output token target in milliseconds, 0 means no target.
 )";
 
 
@@ -444,6 +451,11 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("assistant_confidence_threshold", &GenerationConfig::assistant_confidence_threshold)
         .def_readwrite("num_assistant_tokens", &GenerationConfig::num_assistant_tokens)
         .def_readwrite("max_ngram_size", &GenerationConfig::max_ngram_size)
+        .def_readwrite("num_assistant_branches", &GenerationConfig::num_assistant_branches)
+        .def_readwrite("adaptive_num_assistant_tokens", &GenerationConfig::adaptive_num_assistant_tokens)
+        .def_readwrite("priority", &GenerationConfig::priority)
+        .def_readwrite("ttft_target_ms", &GenerationConfig::ttft_target_ms)
+        .def_readwrite("tpot_target_ms", &GenerationConfig::tpot_target_ms)
         .def_readwrite("include_stop_str_in_output", &GenerationConfig::include_stop_str_in_output)
         .def_readwrite("stop_token_ids", &GenerationConfig::stop_token_ids)
         .def_readwrite("structured_output_config", &GenerationConfig::structured_output_config)
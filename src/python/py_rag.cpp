@@ -32,12 +32,20 @@ Attributes:
     batch_size (int, optional):
         Batch size for the embedding model.
         Useful for database population. If set, the pipeline will fix model shape for inference optimization.
-        Number of documents passed to pipeline should be equal to batch_size.
+        Documents are embedded in batches of batch_size, the last batch is filled up with repeated documents.
         For query embeddings, batch_size should be set to 1 or not set.
+    max_batch_tokens (int, optional):
+        Maximum number of tokens, including padding, in a batch if batch_size is not set. Defaults to 16384.
+        Documents are sorted by length and split into batches within the budget.
+        0 embeds all documents in one batch.
     pooling_type (TextEmbeddingPipeline.PoolingType, optional):
         Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
     normalize (bool, optional):
         If True, L2 normalization is applied to embeddings. Defaults to True.
+    embedding_dimensions (int, optional):
+        Number of the first embedding values to keep for Matryoshka models. Applied before normalization.
+    embedding_type (TextEmbeddingPipeline.EmbeddingType, optional):
+        Type of embeddings. INT8 and UBINARY embeddings are quantized by the model. Defaults to EmbeddingType.FLOAT.
     query_instruction (str, optional):
         Instruction to use for embedding a query.
     embed_instruction (str, optional):
@@ -57,6 +65,11 @@ Attributes:
         If 'True', model input tensors are padded to the maximum length.
     padding_side (str, optional):
         Side to use for padding "left" or "right"
+    max_batch_tokens (int, optional):
+        Maximum number of tokens, including padding, in a batch. Defaults to 16384.
+        Documents are sorted by length and split into batches within the budget.
+        For stateful decoder models, tokens shared by all query-document pairs are inferred once.
+        0 reranks all documents in one batch.
 )";
 
 }  // namespace
@@ -137,6 +150,15 @@ void init_rag_pipelines(py::module_& m) {
         .value("MEAN", TextEmbeddingPipeline::PoolingType::MEAN, "The average of all token embeddings")
         .value("LAST_TOKEN", TextEmbeddingPipeline::PoolingType::LAST_TOKEN, "Last token embeddings");
 
+    py::enum_<TextEmbeddingPipeline::EmbeddingType>(text_embedding_pipeline, "EmbeddingType")
+        .value("FLOAT", TextEmbeddingPipeline::EmbeddingType::FLOAT, "f32 embeddings")
+        .value("INT8",
+               TextEmbeddingPipeline::EmbeddingType::INT8,
+               "Embeddings scaled by 127 / max(abs(embedding)) and rounded to int8")
+        .value("UBINARY",
+               TextEmbeddingPipeline::EmbeddingType::UBINARY,
+               "Signs of embedding values packed into uint8 bits, the most significant bit first");
+
     py::class_<TextEmbeddingPipeline::Config>(text_embedding_pipeline, "Config", text_embedding_config_docstring)
         .def(py::init<>())
         .def(py::init([](py::kwargs kwargs) {
@@ -148,8 +170,11 @@ void init_rag_pipelines(py::module_& m) {
         .def_readwrite("max_length", &TextEmbeddingPipeline::Config::max_length)
         .def_readwrite("pad_to_max_length", &TextEmbeddingPipeline::Config::pad_to_max_length)
         .def_readwrite("batch_size", &TextEmbeddingPipeline::Config::batch_size)
+        .def_readwrite("max_batch_tokens", &TextEmbeddingPipeline::Config::max_batch_tokens)
         .def_readwrite("pooling_type", &TextEmbeddingPipeline::Config::pooling_type)
         .def_readwrite("normalize", &TextEmbeddingPipeline::Config::normalize)
+        .def_readwrite("embedding_dimensions", &TextEmbeddingPipeline::Config::embedding_dimensions)
+        .def_readwrite("embedding_type", &TextEmbeddingPipeline::Config::embedding_type)
         .def_readwrite("query_instruction", &TextEmbeddingPipeline::Config::query_instruction)
         .def_readwrite("embed_instruction", &TextEmbeddingPipeline::Config::embed_instruction)
         .def_readwrite("padding_side", &TextEmbeddingPipeline::Config::padding_side);
@@ -232,7 +257,8 @@ kwargs: Plugin and/or config properties
         .def_readwrite("top_n", &ov::genai::TextRerankPipeline::Config::top_n)
         .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length)
         .def_readwrite("pad_to_max_length", &ov::genai::TextRerankPipeline::Config::pad_to_max_length)
-        .def_readwrite("padding_side", &ov::genai::TextRerankPipeline::Config::padding_side);
+        .def_readwrite("padding_side", &ov::genai::TextRerankPipeline::Config::padding_side)
+        .def_readwrite("max_batch_tokens", &ov::genai::TextRerankPipeline::Config::max_batch_tokens);
 
     text_rerank_pipeline.def(
         py::init([](const std::filesystem::path& models_path,
@@ -68,6 +68,19 @@ Args:
 + std::string(common_encode_docstring)
 );
 
+constexpr char tokenization_cache_stats_docstring[] = R"(
+    Counters of the tokenization cache enabled by 'tokenization_cache_size' Tokenizer property.
+
+    :param hits: Number of text segments taken from the cache.
+    :type hits: int
+
+    :param misses: Number of text segments run through the tokenizer model.
+    :type misses: int
+
+    :param num_cached_tokens: Number of token ids kept in the cache.
+    :type num_cached_tokens: int
+)";
+
 }  // namespace
 
 namespace py = pybind11;
@@ -75,6 +88,7 @@ namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::ChatHistory;
 using ov::genai::JsonContainer;
+using ov::genai::TokenizationCacheStats;
 using ov::genai::TokenizedInputs;
 using ov::genai::Tokenizer;
 
@@ -84,6 +98,13 @@ void init_tokenizer(py::module_& m) {
         .def_readwrite("input_ids", &TokenizedInputs::input_ids)
         .def_readwrite("attention_mask", &TokenizedInputs::attention_mask);
 
+    py::class_<TokenizationCacheStats>(m, "TokenizationCacheStats", tokenization_cache_stats_docstring)
+        .def(py::init<>())
+        .def_readonly("hits", &TokenizationCacheStats::hits)
+        .def_readonly("misses", &TokenizationCacheStats::misses)
+        .def_readonly("num_cached_tokens", &TokenizationCacheStats::num_cached_tokens)
+        .def("get_hit_rate", &TokenizationCacheStats::get_hit_rate);
+
     py::class_<ov::genai::Tokenizer>(m, "Tokenizer", class_docstring)
 
         .def(py::init([](const std::filesystem::path& tokenizer_path, const std::map<std::string, py::object>& properties, const py::kwargs& kwargs) {
@@ -322,5 +343,8 @@ void init_tokenizer(py::module_& m) {
         )
         .def("supports_paired_input", &Tokenizer::supports_paired_input, 
              R"(Returns true if the tokenizer supports paired input, false otherwise.)"
+        )
+        .def("get_tokenization_cache_stats", &Tokenizer::get_tokenization_cache_stats,
+             R"(Returns counters of the tokenization cache, all zeros if 'tokenization_cache_size' property is not set or the cache is disabled.)"
         );
 }
@@ -0,0 +1,54 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "speculative_decoding/adaptive_speculation_controller.hpp"
+
+using namespace ov::genai;
+
+TEST(AdaptiveSpeculationControllerTest, ComputesNumAssistantTokens) {
+    // all candidates are accepted and draft model is free: the longer the better
+    EXPECT_EQ(AdaptiveSpeculationController::compute_num_assistant_tokens(1.f, 0.f, 5), 5);
+    // nothing is accepted: speculation is a net loss
+    EXPECT_EQ(AdaptiveSpeculationController::compute_num_assistant_tokens(0.f, 0.1f, 5), 0);
+    // draft model is as slow as main one
+    EXPECT_EQ(AdaptiveSpeculationController::compute_num_assistant_tokens(0.9f, 1.f, 5), 0);
+    // speedup of k = 1, 2, 3 is 1.333, 1.4, 1.36
+    EXPECT_EQ(AdaptiveSpeculationController::compute_num_assistant_tokens(0.6f, 0.2f, 5), 2);
+}
+
+TEST(AdaptiveSpeculationControllerTest, AdaptsToAcceptanceRate) {
+    AdaptiveSpeculationController controller;
+    EXPECT_EQ(controller.get_num_assistant_tokens(0, 5), 5);
+    controller.update_latency(1.f, 10.f);
+    EXPECT_FLOAT_EQ(controller.get_latency_ratio(), 0.1f);
+
+    // an accepted token and a rejection
+    EXPECT_EQ(controller.update(0, 5, 5, 1), 2);
+    EXPECT_FLOAT_EQ(controller.get_acceptance_rate(0), 0.5f);
+    EXPECT_EQ(controller.get_num_assistant_tokens(0, 5), 2);
+
+    // all candidates are accepted
+    EXPECT_GT(controller.update(0, 5, 2, 2), 2);
+    EXPECT_EQ(controller.update(0, 5, 2, 2), 5);
+    EXPECT_FLOAT_EQ(controller.get_acceptance_rate(0), 1.51f / 2.f);
+
+    // other requests are not affected
+    EXPECT_EQ(controller.get_num_assistant_tokens(1, 5), 5);
+}
+
+TEST(AdaptiveSpeculationControllerTest, FallsBackToPlainDecodingAndProbes) {
+    AdaptiveSpeculationController controller;
+    controller.update_latency(1.f, 10.f);
+    EXPECT_EQ(controller.update(0, 5, 5, 0), 0);
+
+    for (size_t i = 1; i < AdaptiveSpeculationController::PROBE_INTERVAL; ++i) {
+        EXPECT_EQ(controller.update(0, 5, 0, 0), 0);
+    }
+    EXPECT_EQ(controller.update(0, 5, 0, 0), 1);
+
+    controller.remove_request(0);
+    EXPECT_EQ(controller.get_num_assistant_tokens(0, 5), 5);
+    EXPECT_FLOAT_EQ(controller.get_acceptance_rate(0), 0.f);
+}
@@ -299,3 +299,50 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectlyWithPrefixCaching) {
         allocator.free(prefix_hash_map[allocated_block.first], prefix_hash_map);
     }
 }
+
+TEST(TestBlockAllocator, ReusesFreedBlocksInFifoOrder) {
+    auto allocator = ov::genai::BlockAllocator(3, false, 2);
+    auto block0 = allocator.allocate_block();
+    auto block1 = allocator.allocate_block();
+    auto block2 = allocator.allocate_block();
+    EXPECT_EQ(block2[1]->get_index(), 2);
+
+    allocator.free(block1[0], 0);
+    allocator.free(block1[1], 1);
+    allocator.free(block0[0], 0);
+    allocator.free(block0[1], 1);
+    allocator.increase_kv_blocks_number(4);
+    EXPECT_EQ(allocator.num_free_blocks(0), 3);
+
+    // freed blocks are handed out first in the order they were freed, then the newly added ones
+    for (int expected_idx : {1, 0, 3}) {
+        auto blocks = allocator.allocate_block();
+        EXPECT_EQ(blocks[0]->get_index(), expected_idx);
+        EXPECT_EQ(blocks[1]->get_index(), expected_idx);
+        // the same descriptor is handed out again, not a copy
+        EXPECT_EQ(blocks[0]->get_references_count(), 1);
+        allocator.free(blocks[0], 0);
+        allocator.free(blocks[1], 1);
+    }
+    allocator.free(block2[0], 0);
+    allocator.free(block2[1], 1);
+}
+
+TEST(TestBlockIndexQueue, wraps_around_and_grows) {
+    ov::genai::BlockIndexQueue queue;
+    queue.reserve(3);
+    for (int32_t idx : {0, 1, 2}) {
+        queue.push_back(idx);
+    }
+    EXPECT_THROW(queue.push_back(3), ov::Exception);
+    queue.pop_front();
+    queue.push_back(3);  // wraps around
+    queue.reserve(5);
+    queue.push_back(4);
+    std::vector<int32_t> popped;
+    while (!queue.empty()) {
+        popped.push_back(queue.front());
+        queue.pop_front();
+    }
+    EXPECT_EQ(popped, (std::vector<int32_t>{1, 2, 3, 4}));
+}
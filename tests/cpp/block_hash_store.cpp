@@ -5,20 +5,15 @@
 #include <gtest/gtest.h>
 #include "openvino/runtime/core.hpp"
 #include "continuous_batching/scheduler.hpp"
-#include <chrono>
-#include <thread>
 
 TEST(TestBlockHashStore, general_test) {
     ov::genai::OverwritableBlocksHashStore block_hash_store(1);
     auto block0 = std::make_shared<ov::genai::KVCacheBlock>(0);
     block0->set_hash(77);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block1 = std::make_shared<ov::genai::KVCacheBlock>(1);
     block1->set_hash(56);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block2 = std::make_shared<ov::genai::KVCacheBlock>(2);
     block2->set_hash(23);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     block_hash_store.add(ov::genai::BlocksPerLayer{block0});
     block_hash_store.add(ov::genai::BlocksPerLayer{block1});
     block_hash_store.add(ov::genai::BlocksPerLayer{block2});
@@ -38,13 +33,14 @@ TEST(TestBlockHashStore, general_test) {
 
     auto block3 = std::make_shared<ov::genai::KVCacheBlock>(7);
     block3->set_hash(12);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block4 = std::make_shared<ov::genai::KVCacheBlock>(10);
     block4->set_hash(99);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     block_hash_store.add(ov::genai::BlocksPerLayer{block3});
     block_hash_store.add(ov::genai::BlocksPerLayer{block4});
-    block2->set_timestamp(std::chrono::steady_clock::now());
+    // restoring and returning a block makes it the most recently used one
+    auto restored_block2 = block_hash_store.get_block_to_restore(23);
+    restored_block2[0]->release();
+    block_hash_store.add(restored_block2);
 
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 7);
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 10);
@@ -52,3 +48,49 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, clean_store) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(2);
+    for (int i = 0; i < 4; i++) {
+        auto block_layer0 = std::make_shared<ov::genai::KVCacheBlock>(i);
+        auto block_layer1 = std::make_shared<ov::genai::KVCacheBlock>(i);
+        block_layer0->set_hash(100 + i);
+        block_layer1->set_hash(100 + i);
+        block_hash_store.add(ov::genai::BlocksPerLayer{block_layer0, block_layer1});
+    }
+
+    auto cleaned = block_hash_store.clean_store({101, 103, 555});
+    ASSERT_EQ(cleaned.size(), 2);
+    EXPECT_EQ(cleaned[0][0]->get_hash(), 101);
+    EXPECT_EQ(cleaned[1][1]->get_hash(), 103);
+    EXPECT_EQ(block_hash_store.num_blocks(), 2);
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 0);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[1]->get_index(), 2);
+    EXPECT_EQ(block_hash_store.num_blocks(), 0);
+}
+
+TEST(TestBlockHashStore, overwrite_order_follows_return_order) {
+    const size_t num_blocks = 1024;
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    for (size_t i = 0; i < num_blocks; i++) {
+        auto block = std::make_shared<ov::genai::KVCacheBlock>(i);
+        block->set_hash(i);
+        block_hash_store.add(ov::genai::BlocksPerLayer{block});
+    }
+    // every even block is restored and returned, so it becomes more recent than all odd ones
+    for (size_t i = 0; i < num_blocks; i += 2) {
+        auto blocks = block_hash_store.get_block_to_restore(i);
+        ASSERT_EQ(blocks.size(), 1);
+        blocks[0]->release();
+        block_hash_store.add(blocks);
+    }
+
+    for (size_t i = 1; i < num_blocks; i += 2) {
+        EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), i);
+    }
+    for (size_t i = 0; i < num_blocks; i += 2) {
+        EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), i);
+    }
+    EXPECT_EQ(block_hash_store.num_blocks(), 0);
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the time to take the least recently used block of the prefix cache for overwriting and to return it
+// under a new hash (ns/overwrite) for 1k, 16k and 128k cached blocks, comparing OverwritableBlocksHashStore
+// with a linear scan over block timestamps.
+// Usage: block_hash_store_benchmark [num_overwrites]
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "continuous_batching/block_manager.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// LRU selection by a linear scan over timestamps, as the store used to do before the LRU list was introduced
+class ScanBasedLRUStore {
+    using Timestamp = std::chrono::time_point<std::chrono::steady_clock>;
+    std::map<size_t, std::pair<Timestamp, BlocksPerLayer>> m_blocks;
+public:
+    void add(const BlocksPerLayer& blocks) {
+        m_blocks[blocks[0]->get_hash()] = {std::chrono::steady_clock::now(), blocks};
+    }
+
+    BlocksPerLayer get_lru_block_to_overwrite() {
+        auto it = std::min_element(m_blocks.begin(), m_blocks.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.first < rhs.second.first;
+        });
+        auto blocks = it->second.second;
+        for (auto& block : blocks) {
+            block->increment();
+        }
+        m_blocks.erase(it);
+        return blocks;
+    }
+};
+
+// Fills the store with `num_blocks` blocks, then measures the average time of `num_overwrites` cycles
+// of taking the LRU block for overwriting and returning it to the store under a new hash.
+template <typename Store>
+double measure_overwrite_ns(size_t num_blocks, size_t num_overwrites) {
+    Store store;
+    for (size_t i = 0; i < num_blocks; i++) {
+        auto block = std::make_shared<KVCacheBlock>(i);
+        block->set_hash(i);
+        store.add(BlocksPerLayer{block});
+    }
+    size_t next_hash = num_blocks;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_overwrites; i++) {
+        auto blocks = store.get_lru_block_to_overwrite();
+        blocks[0]->release();
+        blocks[0]->set_hash(next_hash++);
+        store.add(blocks);
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(duration).count() / num_overwrites;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t num_overwrites = argc > 1 ? std::stoul(argv[1]) : 256;
+
+    std::cout << std::left << std::setw(10) << "blocks"
+              << std::right << std::setw(20) << "LRU list ns/op" << std::setw(20) << "scan ns/op" << std::setw(10) << "speedup" << std::endl;
+    for (size_t num_blocks : {1024, 16384, 131072}) {
+        const double lru_ns = measure_overwrite_ns<OverwritableBlocksHashStore>(num_blocks, num_overwrites);
+        const double scan_ns = measure_overwrite_ns<ScanBasedLRUStore>(num_blocks, num_overwrites);
+        std::cout << std::left << std::setw(10) << num_blocks
+                  << std::right << std::fixed << std::setprecision(0) << std::setw(20) << lru_ns << std::setw(20) << scan_ns
+                  << std::setprecision(2) << std::setw(9) << scan_ns / lru_ns << "x" << std::endl;
+    }
+    return 0;
+}
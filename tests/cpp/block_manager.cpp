@@ -89,6 +89,45 @@ TEST(TestBlockManager, required_blocks_count) {
     }
 }
 
+TEST(TestBlockManager, copies_shared_last_block_before_crossing_block_boundary) {
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, 4, 3);
+
+    std::vector<int64_t> tokens = {0, 1, 2, 3, 4};
+    ov::genai::SequenceGroup::Ptr sequence_group =
+        std::make_shared<ov::genai::SequenceGroup>(0,
+                                                   ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                   ov::genai::utils::get_beam_search_config(),
+                                                   4);
+    sequence_group->schedule_tokens(5);
+    bm.append_slots(sequence_group);
+    sequence_group->finish_iteration();
+
+    auto parent = sequence_group->get_running_sequences()[0];
+    auto child = sequence_group->fork_sequence(parent);
+    bm.fork_sequence(parent->get_id(), child->get_id());
+
+    // 4 tokens per sequence: 3 of them go to the partially filled shared block, the last one to a new block
+    sequence_group->schedule_tokens(4);
+    // a new block for each sequence and a copy of the shared one
+    EXPECT_EQ(bm.required_blocks_count(sequence_group), 3);
+    auto copy_blocks_map = bm.append_slots(sequence_group);
+    EXPECT_EQ(bm.num_free_blocks(), 3);
+
+    const auto& parent_blocks = bm.get_block_table(parent->get_id(), 0);
+    const auto& child_blocks = bm.get_block_table(child->get_id(), 0);
+    ASSERT_EQ(parent_blocks.size(), 3);
+    ASSERT_EQ(child_blocks.size(), 3);
+    EXPECT_EQ(parent_blocks[0], child_blocks[0]);
+    EXPECT_NE(parent_blocks[1], child_blocks[1]);
+    EXPECT_NE(parent_blocks[2], child_blocks[2]);
+    // the first sequence gets the copy, the second one keeps the original block
+    EXPECT_EQ(copy_blocks_map.count(child_blocks[1]->get_index()), 1);
+
+    for (auto& sequence : sequence_group->get_sequences()) {
+        bm.free_sequence(sequence->get_id());
+    }
+}
+
 TEST(TestBlockManager, CanFreeBlocksFromSequence) {
     const size_t BLOCK_SIZE = 2;
     ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, BLOCK_SIZE, 3);
@@ -111,3 +150,35 @@ TEST(TestBlockManager, CanFreeBlocksFromSequence) {
         bm.free_sequence(sequence->get_id());
     }
 }
+
+TEST(TestBlockManager, restores_full_blocks_of_sequence_from_prefix_cache) {
+    ov::genai::BlockManager bm = ov::genai::BlockManager(4, true, 4);
+    std::vector<int64_t> tokens = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ov::genai::SequenceGroup::Ptr sequence_group =
+        std::make_shared<ov::genai::SequenceGroup>(0,
+                                                   ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                   ov::genai::utils::get_greedy_config(),
+                                                   4);
+    auto sequence = sequence_group->get_not_finished_sequences()[0];
+    auto seq_id = sequence->get_id();
+    bm.allocate(sequence, 3, tokens.size());
+    std::vector<size_t> block_indices;
+    for (const auto& block : bm.get_block_table(seq_id, 0)) {
+        block_indices.push_back(block->get_index());
+    }
+
+    // e.g. the sequence is swapped out, its blocks stay in the prefix cache
+    bm.free_sequence(seq_id);
+    EXPECT_FALSE(bm.has_block_table(seq_id));
+
+    EXPECT_EQ(bm.restore_cached_blocks(sequence, 2), 2);
+    const auto& block_table = bm.get_block_table(seq_id, 0);
+    ASSERT_EQ(block_table.size(), 2);
+    EXPECT_EQ(block_table[0]->get_index(), block_indices[0]);
+    EXPECT_EQ(block_table[1]->get_index(), block_indices[1]);
+
+    // the partially filled block is allocated anew
+    bm.allocate(sequence, 1, tokens.size());
+    EXPECT_EQ(bm.get_block_table(seq_id, 0).size(), 3);
+    bm.free_sequence(seq_id);
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include <gtest/gtest.h>
 #include "openvino/runtime/core.hpp"
 #include "continuous_batching/scheduler.hpp"
@@ -106,3 +108,66 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+TEST(TestCacheManager, test_dynamic_cache_increase_in_reserved_memory) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    const size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+    cache_manager->reserve_host_cache(300);
+
+    cache_manager->allocate_cache_if_needed(100);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+    const void* key_cache_data = cache_manager->get_key_cache(0).data();
+    const size_t num_bytes = cache_manager->get_key_cache(0).get_byte_size();
+    std::memset(cache_manager->get_key_cache(0).data(), 42, num_bytes);
+
+    // growing within the reservation keeps the cache in place
+    cache_manager->allocate_cache_if_needed(200);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
+    ASSERT_EQ(cache_manager->get_key_cache(0).data(), key_cache_data);
+    const uint8_t* key_cache_bytes = static_cast<const uint8_t*>(cache_manager->get_key_cache(0).data());
+    EXPECT_EQ(key_cache_bytes[0], 42);
+    EXPECT_EQ(key_cache_bytes[num_bytes - 1], 42);
+
+    // growing beyond the reservation reallocates the cache and keeps its contents
+    cache_manager->allocate_cache_if_needed(400);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 400 * block_size_in_bytes);
+    key_cache_bytes = static_cast<const uint8_t*>(cache_manager->get_key_cache(0).data());
+    EXPECT_EQ(key_cache_bytes[0], 42);
+    EXPECT_EQ(key_cache_bytes[num_bytes - 1], 42);
+}
+
+TEST(TestCacheManager, test_copy_blocks) {
+    ov::Core core;
+    const size_t num_decoder_layers = 3;
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    const size_t num_kv_blocks = 8;
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            const size_t stride = cache.get_byte_size() / num_kv_blocks;
+            for (size_t block_id = 0; block_id < num_kv_blocks; block_id++) {
+                std::memset(static_cast<uint8_t*>(cache.data()) + block_id * stride, static_cast<int>(block_id), stride);
+            }
+        }
+    }
+
+    // nothing was written to block 3 yet, so it is not copied
+    cache_manager->copy_blocks({{1, {4, 5}}, {2, {7}}, {3, {6}}}, {{3, 0}});
+
+    const std::vector<uint8_t> expected_blocks = {0, 1, 2, 3, 1, 1, 6, 2};
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            const size_t stride = cache.get_byte_size() / num_kv_blocks;
+            const uint8_t* data = static_cast<const uint8_t*>(cache.data());
+            for (size_t block_id = 0; block_id < num_kv_blocks; block_id++) {
+                EXPECT_EQ(data[block_id * stride], expected_blocks[block_id]);
+                EXPECT_EQ(data[(block_id + 1) * stride - 1], expected_blocks[block_id]);
+            }
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "sampling/fused_sampling.hpp"
+
+using namespace ov::genai;
+using namespace ov::genai::LogitTransformers;
+
+namespace {
+// Runs the transform chain the fused kernel replaces and returns { token index -> probability within the final set }.
+std::map<int64_t, float> reference_distribution(std::vector<float> data, const FusedSamplingParams& params) {
+    auto logits = Logits(data.data(), data.size());
+    const bool top_k_active = params.top_k > 0 && params.top_k < data.size();
+    if (top_k_active) {
+        TopKFilter(params.top_k).apply(logits);
+    }
+    TemperatureLogitTransform(params.temperature).apply(logits);
+    if (params.top_p < 1.0f) {
+        TopPFilter(params.top_p).apply(logits);
+    }
+
+    std::map<int64_t, float> distribution;
+    float sum = 0.0f;
+    if (logits.is_vector_initialized()) {
+        for (size_t i = 0; i < logits.m_size; ++i) {
+            distribution[logits.m_vector[i].m_index] = logits.m_vector[i].m_log_prob;
+            sum += logits.m_vector[i].m_log_prob;
+        }
+    } else {
+        for (size_t i = 0; i < logits.m_size; ++i) {
+            distribution[i] = logits.m_data[i];
+            sum += logits.m_data[i];
+        }
+    }
+    for (auto& [index, prob] : distribution) {
+        prob /= sum;
+    }
+    return distribution;
+}
+
+std::vector<float> random_logits(size_t size, size_t seed) {
+    std::mt19937 generator(seed);
+    std::normal_distribution<float> distribution(0.0f, 3.0f);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = distribution(generator);
+    }
+    return data;
+}
+}
+
+struct FusedSamplingTestStruct {
+    FusedSamplingParams params;
+};
+
+using FusedSamplingTest = testing::TestWithParam<FusedSamplingTestStruct>;
+
+TEST_P(FusedSamplingTest, SamplesFromReferenceDistribution) {
+    const auto params = GetParam().params;
+    const auto data = random_logits(2000, 7);
+    const auto expected = reference_distribution(data, params);
+
+    FusedSamplingKernel kernel;
+    std::mt19937 rng_engine(42);
+    std::vector<Token> tokens;
+    const size_t num_draws = 4000;
+    kernel.sample(data.data(), data.size(), params, num_draws, rng_engine, tokens);
+    ASSERT_EQ(tokens.size(), num_draws);
+
+    std::map<int64_t, size_t> counts;
+    for (const auto& token : tokens) {
+        auto it = expected.find(token.m_index);
+        ASSERT_NE(it, expected.end()) << "token " << token.m_index << " is filtered out by the transform chain";
+        EXPECT_NEAR(std::exp(token.m_log_prob), it->second, 1e-4);
+        counts[token.m_index]++;
+    }
+    // the row must not be modified
+    EXPECT_EQ(data, random_logits(2000, 7));
+    // frequent tokens are drawn with their probability
+    for (const auto& [index, prob] : expected) {
+        if (prob > 0.05f) {
+            EXPECT_NEAR(static_cast<float>(counts[index]) / num_draws, prob, 0.03f) << "token " << index;
+        }
+    }
+}
+
+const std::vector<FusedSamplingTestStruct> FUSED_SAMPLING_TEST_CASES = {
+    {{std::numeric_limits<size_t>::max(), 1.0f, 1.0f}},
+    {{std::numeric_limits<size_t>::max(), 0.7f, 1.0f}},
+    {{20, 1.0f, 1.0f}},
+    {{20, 2.0f, 1.0f}},
+    {{std::numeric_limits<size_t>::max(), 1.0f, 0.9f}},
+    {{std::numeric_limits<size_t>::max(), 0.5f, 0.5f}},
+    {{50, 1.5f, 0.8f}},
+};
+
+INSTANTIATE_TEST_SUITE_P(VariousParams,
+                         FusedSamplingTest,
+                         testing::ValuesIn(FUSED_SAMPLING_TEST_CASES));
+
+TEST(FusedSamplingTest, FallsBackToUniformOverMaskedCandidates) {
+    std::vector<float> data(100, -std::numeric_limits<float>::infinity());
+    FusedSamplingKernel kernel;
+    std::mt19937 rng_engine(42);
+    std::vector<Token> tokens;
+    kernel.sample(data.data(), data.size(), {10, 1.0f, 0.9f}, 5, rng_engine, tokens);
+    ASSERT_EQ(tokens.size(), 5);
+    for (const auto& token : tokens) {
+        EXPECT_LT(token.m_index, 10);
+        EXPECT_NEAR(token.m_log_prob, std::log(0.1f), 1e-6);
+    }
+}
+
+TEST(FusedSamplingTest, ArgmaxReturnsFirstMaximum) {
+    auto data = random_logits(1000, 3);
+    data[517] = 100.0f;
+    data[901] = 100.0f;
+    EXPECT_EQ(FusedSamplingKernel::argmax(data.data(), data.size()), 517);
+    data[3] = 200.0f;
+    EXPECT_EQ(FusedSamplingKernel::argmax(data.data(), data.size()), 3);
+    data[999] = 300.0f;
+    EXPECT_EQ(FusedSamplingKernel::argmax(data.data(), data.size()), 999);
+}
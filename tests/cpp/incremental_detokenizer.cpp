@@ -0,0 +1,64 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/incremental_detokenizer.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::shared_ptr<const TokenTextTable> make_table(std::vector<std::string> token_bytes, bool strip_leading_space = false) {
+    auto table = std::make_shared<TokenTextTable>();
+    table->m_token_bytes = std::move(token_bytes);
+    table->m_strip_leading_space = strip_leading_space;
+    return table;
+}
+}  // namespace
+
+TEST(IncrementalDetokenizerTest, KeepsIncompleteCharacter) {
+    // "🙂" is F0 9F 99 82 split between byte fallback tokens
+    IncrementalDetokenizer detokenizer(make_table({" Hi", "\xF0", "\x9F", "\x99", "\x82", "!"}));
+    EXPECT_EQ(detokenizer.write(0), " Hi");
+    EXPECT_EQ(detokenizer.write(1), "");
+    EXPECT_EQ(detokenizer.write(2), "");
+    EXPECT_EQ(detokenizer.write(3), "");
+    EXPECT_TRUE(detokenizer.has_incomplete());
+    EXPECT_EQ(detokenizer.write(4), "🙂");
+    EXPECT_FALSE(detokenizer.has_incomplete());
+    EXPECT_EQ(detokenizer.write(5), "!");
+    EXPECT_EQ(detokenizer.end(), "");
+}
+
+TEST(IncrementalDetokenizerTest, ReplacesInvalidSequences) {
+    IncrementalDetokenizer detokenizer(make_table({"a", "\xF0\x9F", "\xFF", "\xE2\x82"}));
+    EXPECT_EQ(detokenizer.write(1), "");
+    // the incomplete character is interrupted by an invalid byte
+    EXPECT_EQ(detokenizer.write(2), "\xEF\xBF\xBD\xEF\xBF\xBD");
+    EXPECT_EQ(detokenizer.write(0), "a");
+    EXPECT_EQ(detokenizer.write(3), "");
+    EXPECT_EQ(detokenizer.end(), "\xEF\xBF\xBD");
+}
+
+TEST(IncrementalDetokenizerTest, StripsLeadingSpaceOfText) {
+    // the empty token is a skipped special one
+    IncrementalDetokenizer detokenizer(make_table({"", " Hello", " world"}, true));
+    EXPECT_EQ(detokenizer.write(0), "");
+    EXPECT_EQ(detokenizer.write(1), "Hello");
+    EXPECT_EQ(detokenizer.write(2), " world");
+    detokenizer.reset();
+    EXPECT_EQ(detokenizer.write(2), "world");
+    EXPECT_THROW(detokenizer.write(3), ov::Exception);
+}
+
+TEST(IncrementalDetokenizerTest, MapsVocabEntriesToBytes) {
+    EXPECT_EQ(byte_level_token_bytes("\xC4\xA0Hello"), " Hello");  // "ĠHello"
+    EXPECT_EQ(byte_level_token_bytes("\xC4\x8A"), "\n");  // "Ċ"
+    EXPECT_EQ(byte_level_token_bytes("\xC3\xB0\xC5\x81"), "\xF0\x9F");  // "ðŁ"
+    EXPECT_EQ(byte_level_token_bytes("<|endoftext|>"), "<|endoftext|>");
+
+    EXPECT_EQ(sentencepiece_token_bytes("\xE2\x96\x81Hello"), " Hello");  // "▁Hello"
+    EXPECT_EQ(sentencepiece_token_bytes("<0x0A>"), "\n");
+    EXPECT_EQ(sentencepiece_token_bytes("<0xF0>"), "\xF0");
+    EXPECT_EQ(sentencepiece_token_bytes("<s>"), "<s>");
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <numeric>
+
+#include "continuous_batching/kv_cache_spill_store.hpp"
+
+using namespace ov::genai;
+
+class KVCacheSpillStoreTest : public ::testing::Test {
+protected:
+    static constexpr size_t BLOCK_SIZE_IN_BYTES = 64;
+    static constexpr uint64_t FINGERPRINT = 42;
+    std::filesystem::path m_path;
+
+    void SetUp() override {
+        m_path = std::filesystem::temp_directory_path() /
+                 (std::string("kv_cache_spill_store_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin");
+        std::filesystem::remove(m_path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_path);
+    }
+
+    // room for exactly `num_slots` blocks
+    static size_t file_size_for(size_t num_slots) {
+        return 32 + num_slots * (16 + BLOCK_SIZE_IN_BYTES);
+    }
+
+    static std::vector<uint8_t> make_block(uint8_t start) {
+        std::vector<uint8_t> data(BLOCK_SIZE_IN_BYTES);
+        std::iota(data.begin(), data.end(), start);
+        return data;
+    }
+};
+
+TEST_F(KVCacheSpillStoreTest, write_and_read) {
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    EXPECT_EQ(store.capacity(), 4);
+    EXPECT_EQ(store.num_blocks(), 0);
+
+    auto block = make_block(7);
+    store.write(123, block.data());
+    EXPECT_TRUE(store.contains(123));
+    EXPECT_FALSE(store.contains(124));
+
+    std::vector<uint8_t> result(BLOCK_SIZE_IN_BYTES);
+    EXPECT_TRUE(store.read(123, result.data()));
+    EXPECT_EQ(result, block);
+    EXPECT_FALSE(store.read(124, result.data()));
+}
+
+TEST_F(KVCacheSpillStoreTest, overwrites_oldest_block_when_full) {
+    KVCacheSpillStore store(m_path, file_size_for(2), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    store.write(1, make_block(1).data());
+    store.write(2, make_block(2).data());
+    store.write(3, make_block(3).data());
+
+    EXPECT_EQ(store.num_blocks(), 2);
+    EXPECT_FALSE(store.contains(1));
+    std::vector<uint8_t> result(BLOCK_SIZE_IN_BYTES);
+    EXPECT_TRUE(store.read(2, result.data()));
+    EXPECT_EQ(result, make_block(2));
+    EXPECT_TRUE(store.read(3, result.data()));
+    EXPECT_EQ(result, make_block(3));
+}
+
+TEST_F(KVCacheSpillStoreTest, survives_reopening) {
+    {
+        KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+        store.write(10, make_block(10).data());
+        store.write(20, make_block(20).data());
+    }
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    EXPECT_EQ(store.num_blocks(), 2);
+    std::vector<uint8_t> result(BLOCK_SIZE_IN_BYTES);
+    EXPECT_TRUE(store.read(20, result.data()));
+    EXPECT_EQ(result, make_block(20));
+}
+
+TEST_F(KVCacheSpillStoreTest, discards_file_with_other_layout) {
+    {
+        KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+        store.write(10, make_block(10).data());
+    }
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT + 1);
+    EXPECT_EQ(store.num_blocks(), 0);
+    EXPECT_FALSE(store.contains(10));
+}
+
+TEST_F(KVCacheSpillStoreTest, pending_transfers_keep_order) {
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    store.write(5, make_block(5).data());
+
+    store.schedule_spill(1, {3});
+    // already in the store, nothing to spill
+    store.schedule_spill(5, {4});
+    std::vector<uint8_t> data(BLOCK_SIZE_IN_BYTES);
+    ASSERT_TRUE(store.read(5, data.data()));
+    store.schedule_restore(5, {3}, data);
+
+    auto transfers = store.take_pending_transfers();
+    ASSERT_EQ(transfers.size(), 2);
+    EXPECT_EQ(transfers[0].direction, KVCacheSpillTransfer::Direction::SPILL);
+    EXPECT_EQ(transfers[0].hash, 1);
+    EXPECT_EQ(transfers[0].block_indices, std::vector<size_t>{3});
+    EXPECT_EQ(transfers[1].direction, KVCacheSpillTransfer::Direction::RESTORE);
+    EXPECT_EQ(transfers[1].data, make_block(5));
+    EXPECT_TRUE(store.take_pending_transfers().empty());
+}
+
+TEST_F(KVCacheSpillStoreTest, reuses_released_buffers) {
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    store.write(5, make_block(5).data());
+
+    std::vector<uint8_t> data = store.acquire_buffer();
+    ASSERT_EQ(data.size(), BLOCK_SIZE_IN_BYTES);
+    ASSERT_TRUE(store.read(5, data.data()));
+    const uint8_t* data_ptr = data.data();
+    store.schedule_restore(5, {3}, std::move(data));
+
+    auto transfers = store.take_pending_transfers();
+    ASSERT_EQ(transfers.size(), 1);
+    store.release_buffer(std::move(transfers[0].data));
+    EXPECT_EQ(store.acquire_buffer().data(), data_ptr);
+}
+
+TEST_F(KVCacheSpillStoreTest, async_writes_are_visible_before_written) {
+    KVCacheSpillStore store(m_path, file_size_for(4), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    for (uint8_t i = 1; i <= 3; ++i) {
+        store.write_async(i, make_block(i));
+        EXPECT_TRUE(store.contains(i));
+        std::vector<uint8_t> result(BLOCK_SIZE_IN_BYTES);
+        EXPECT_TRUE(store.read(i, result.data()));
+        EXPECT_EQ(result, make_block(i));
+    }
+    store.wait_for_writes();
+    EXPECT_EQ(store.num_blocks(), 3);
+}
+
+TEST_F(KVCacheSpillStoreTest, async_writes_are_flushed_on_destruction) {
+    {
+        KVCacheSpillStore store(m_path, file_size_for(64), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+        // more blocks than the writer queue can hold
+        for (uint8_t i = 0; i < 40; ++i) {
+            store.write_async(i, make_block(i));
+        }
+    }
+    KVCacheSpillStore store(m_path, file_size_for(64), BLOCK_SIZE_IN_BYTES, FINGERPRINT);
+    EXPECT_EQ(store.num_blocks(), 40);
+    std::vector<uint8_t> result(BLOCK_SIZE_IN_BYTES);
+    EXPECT_TRUE(store.read(39, result.data()));
+    EXPECT_EQ(result, make_block(39));
+}
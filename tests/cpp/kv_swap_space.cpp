@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/kv_swap_space.hpp"
+
+using namespace ov::genai;
+
+TEST(KVCacheSwapSpaceTest, KeepsBlocksOfSwappedOutRequests) {
+    KVCacheSwapSpace swap_space(64, 16);
+    EXPECT_EQ(swap_space.get_num_free_slots(), 4);
+
+    auto buffers = swap_space.swap_out(7, 42, 3);
+    ASSERT_EQ(buffers.size(), 3);
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        std::memset(buffers[i], static_cast<int>(i + 1), 16);
+    }
+    EXPECT_TRUE(swap_space.is_swapped(7));
+    EXPECT_FALSE(swap_space.is_swapped(42));
+    EXPECT_EQ(swap_space.get_num_free_slots(), 1);
+    EXPECT_FALSE(swap_space.can_swap_out(2));
+
+    const auto& swapped = swap_space.get_swapped_sequence(7);
+    EXPECT_EQ(swapped.sequence_id, 42);
+    ASSERT_EQ(swapped.slots.size(), 3);
+    for (size_t i = 0; i < swapped.slots.size(); ++i) {
+        const uint8_t* data = swap_space.get_slot_data(swapped.slots[i]);
+        EXPECT_EQ(data[0], i + 1);
+        EXPECT_EQ(data[15], i + 1);
+    }
+    EXPECT_THROW(swap_space.swap_out(7, 42, 1), ov::Exception);
+    EXPECT_THROW(swap_space.swap_out(8, 43, 2), ov::Exception);
+
+    swap_space.release(7);
+    EXPECT_TRUE(swap_space.empty());
+    EXPECT_EQ(swap_space.get_num_free_slots(), 4);
+    EXPECT_THROW(swap_space.get_swapped_sequence(7), ov::Exception);
+}
+
+TEST(KVCacheSwapSpaceTest, ReusesReleasedSlots) {
+    KVCacheSwapSpace swap_space(48, 16);
+    swap_space.swap_out(0, 0, 2);
+    swap_space.swap_out(1, 1, 1);
+    auto used_slots = swap_space.get_swapped_sequence(0).slots;
+    swap_space.release(0);
+
+    swap_space.swap_out(2, 2, 2);
+    auto reused_slots = swap_space.get_swapped_sequence(2).slots;
+    std::sort(used_slots.begin(), used_slots.end());
+    std::sort(reused_slots.begin(), reused_slots.end());
+    EXPECT_EQ(used_slots, reused_slots);
+    EXPECT_EQ(swap_space.get_swapped_request_ids(), std::vector<uint64_t>({1, 2}));
+}
+
+TEST(KVCacheSwapSpaceTest, RequiresRoomForAtLeastOneBlock) {
+    EXPECT_THROW(KVCacheSwapSpace(8, 16), ov::Exception);
+}
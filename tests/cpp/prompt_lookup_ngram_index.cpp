@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "prompt_lookup/ngram_index.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// reference: rescan of the whole sequence for each n-gram size
+std::vector<int64_t> find_candidates_by_scan(const std::vector<int64_t>& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+    const size_t input_length = input_ids.size();
+    if (max_ngram_size >= input_length) {
+        max_ngram_size = input_length / 2;
+    }
+    for (size_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
+        for (size_t input_i = 0; input_i + ngram_size < input_length; input_i++) {
+            if (!std::equal(input_ids.end() - ngram_size, input_ids.end(), input_ids.begin() + input_i)) {
+                continue;
+            }
+            size_t start_candidate_idx = input_i + ngram_size;
+            size_t available_num_pred = std::min(input_length - start_candidate_idx, num_pred_tokens);
+            return {input_ids.begin() + start_candidate_idx, input_ids.begin() + start_candidate_idx + available_num_pred};
+        }
+    }
+    return {};
+}
+}
+
+TEST(TestNgramIndex, finds_earliest_match_of_longest_ngram) {
+    NgramIndex index(3);
+    index.append(std::vector<int64_t>{1, 2, 3, 4, 9, 2, 3, 5, 1, 2, 3});
+    // "1 2 3" first occurs at the start and is followed by "4 9"
+    EXPECT_EQ(index.find_candidates(2, 3), (std::vector<int64_t>{4, 9}));
+    // the continuation is limited by the sequence end
+    EXPECT_EQ(index.find_candidates(100, 3), (std::vector<int64_t>{4, 9, 2, 3, 5, 1, 2, 3}));
+    EXPECT_TRUE(index.find_candidates(0, 3).empty());
+
+    index.append(7);
+    EXPECT_TRUE(index.find_candidates(2, 3).empty());
+}
+
+TEST(TestNgramIndex, truncate_reverts_entries) {
+    NgramIndex index(2);
+    index.append(std::vector<int64_t>{5, 6, 7});
+    index.append(std::vector<int64_t>{5, 6});
+    EXPECT_EQ(index.find_candidates(1, 2), (std::vector<int64_t>{7}));
+
+    index.truncate(3);
+    EXPECT_EQ(index.size(), 3);
+    EXPECT_TRUE(index.find_candidates(1, 2).empty());
+
+    index.sync({5, 6}, {7, 8, 5, 6});
+    EXPECT_EQ(index.size(), 6);
+    EXPECT_EQ(index.find_candidates(2, 2), (std::vector<int64_t>{7, 8}));
+
+    // the generated tail was replaced
+    index.sync({5, 6}, {7, 8, 5, 7});
+    EXPECT_EQ(index.get_tokens(), (std::vector<int64_t>{5, 6, 7, 8, 5, 7}));
+    EXPECT_EQ(index.find_candidates(2, 2), (std::vector<int64_t>{8, 5}));
+}
+
+TEST(TestNgramIndex, matches_full_scan) {
+    std::mt19937 generator(42);
+    // small vocabulary to get plenty of repeated n-grams
+    std::uniform_int_distribution<int64_t> token_distribution(0, 4);
+    std::uniform_int_distribution<size_t> accepted_distribution(0, 5);
+
+    const size_t max_ngram_size = 4;
+    const size_t num_pred_tokens = 5;
+    const std::vector<int64_t> prompt = {0, 1, 2, 3, 4, 0, 1};
+    std::vector<int64_t> generated = {2};
+    NgramIndex index(max_ngram_size);
+    for (size_t step = 0; step < 500; ++step) {
+        index.sync(prompt, generated);
+
+        std::vector<int64_t> full_input_ids = prompt;
+        full_input_ids.insert(full_input_ids.end(), generated.begin(), generated.end());
+        ASSERT_EQ(index.get_tokens(), full_input_ids);
+        ASSERT_EQ(index.find_candidates(num_pred_tokens, max_ngram_size),
+                  find_candidates_by_scan(full_input_ids, num_pred_tokens, max_ngram_size)) << "step " << step;
+
+        // emulate validation: some of the candidates are accepted, the rest is rolled back and a new token is sampled
+        size_t num_accepted = accepted_distribution(generator);
+        for (size_t i = 0; i < num_accepted; ++i) {
+            generated.push_back(token_distribution(generator));
+        }
+        generated.push_back(token_distribution(generator));
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/reserved_host_memory.hpp"
+
+using namespace ov::genai;
+
+TEST(ReservedHostMemoryTest, GrowsInPlaceKeepingContents) {
+    ReservedHostMemory memory(1 << 20);
+    EXPECT_GE(memory.get_capacity(), 1 << 20);
+    EXPECT_EQ(memory.get_committed_size(), 0);
+    uint8_t* data = memory.data();
+
+    memory.commit(100);
+    EXPECT_GE(memory.get_committed_size(), 100);
+    std::memset(data, 7, 100);
+
+    memory.commit(512 * 1024);
+    EXPECT_EQ(memory.data(), data);
+    EXPECT_EQ(data[0], 7);
+    EXPECT_EQ(data[99], 7);
+    std::memset(data + 100, 8, 512 * 1024 - 100);
+    EXPECT_EQ(data[512 * 1024 - 1], 8);
+
+    EXPECT_THROW(memory.commit(memory.get_capacity() + 1), std::bad_alloc);
+}
+
+TEST(ReservedHostMemoryTest, DecommitsAndCommitsAgain) {
+    ReservedHostMemory memory(1 << 16);
+    memory.commit(1 << 16);
+    std::memset(memory.data(), 1, 1 << 16);
+    memory.decommit();
+    EXPECT_EQ(memory.get_committed_size(), 0);
+
+    memory.commit(16);
+    EXPECT_EQ(memory.data()[0], 0);
+}
+
+TEST(ReservedHostMemoryTest, AllocatorPlacesBuffersAtTheBeginning) {
+    auto memory = std::make_shared<ReservedHostMemory>(1 << 16);
+    ReservedHostMemoryAllocator allocator{memory}, other{std::make_shared<ReservedHostMemory>(1 << 16)};
+    EXPECT_EQ(allocator.allocate(1000, 64), memory->data());
+    EXPECT_GE(memory->get_committed_size(), 1000);
+    EXPECT_EQ(allocator.allocate(4000, 64), memory->data());
+    EXPECT_TRUE(allocator.is_equal(ReservedHostMemoryAllocator{memory}));
+    EXPECT_FALSE(allocator.is_equal(other));
+}
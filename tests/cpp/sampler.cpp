@@ -301,3 +301,172 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerPrepare, creates_request_info_before_sampling) {
+    auto sampling_config = ov::genai::utils::get_greedy_config();
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+        SequenceGroup::Ptr(new SequenceGroup(1, input_tensor, sampling_config, 32)),
+    };
+
+    // only the first group is scheduled, logits are gathered for the last prompt token
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+    sequence_groups.front()->set_output_seq_len(1);
+
+    Sampler sampler;
+    sampler.prepare(sequence_groups, 5);
+    ASSERT_NO_THROW(sampler.get_logit_processor(0));
+    ASSERT_THROW(sampler.get_logit_processor(1), ov::Exception);
+
+    // sampling reuses the prepared state
+    std::vector<float> logits = {0, 0, 0, 1.f, 0};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 5}, logits.data());
+    sequence_groups.erase(sequence_groups.begin() + 1);
+    sampler.sample(sequence_groups, logits_tensor);
+
+    TokenIds expected{3};
+    ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
+}
+
+TEST(SamplerAssistantBranches, draft_branches_off_top_tokens) {
+    auto sampling_config = ov::genai::utils::get_greedy_config();
+    sampling_config.num_assistant_branches = 2;
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+    sequence_groups.front()->set_output_seq_len(1);
+
+    // the best token starts the original sequence, the second best one starts a new branch
+    std::vector<float> logits = {0, 0.5f, 0, 1.f, 0};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 5}, logits.data());
+
+    Sampler sampler;
+    auto sampler_output = sampler.sample(sequence_groups, logits_tensor);
+
+    const auto& sequences = sequence_groups.front()->get_sequences();
+    ASSERT_EQ(sequences.size(), 2);
+    ASSERT_EQ(sequences[0]->get_generated_ids(), TokenIds{3});
+    ASSERT_EQ(sequences[1]->get_generated_ids(), TokenIds{1});
+    ASSERT_EQ(sampler_output.m_forked_sequences.at(sequences[0]->get_id()), std::list<uint64_t>{sequences[1]->get_id()});
+}
+
+TEST(SamplerAssistantBranches, validation_keeps_longest_branch) {
+    auto sampling_config = ov::genai::utils::get_greedy_config();
+    sampling_config.num_assistant_branches = 2;
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+
+    // to emulate processed prompt and add next token [ 0 ]
+    auto sequence = sequence_groups.front()->get_sequences().front();
+    sequence->append_token(0, 1.f);
+    sequence_groups.front()->update_processed_tokens_num(5);
+
+    // candidates of two branches: [ 1, 2 ] and [ 3, 4 ]
+    auto branch = sequence_groups.front()->fork_sequence(sequence, 1);
+    sequence->append_token(1, 1.f);
+    sequence->append_token(2, 1.f);
+    branch->append_token(3, 1.f);
+    branch->append_token(4, 1.f);
+
+    size_t num_validated_tokens = 2;
+    sequence_groups.front()->set_num_validated_tokens(num_validated_tokens);
+    const auto num_scheduled_tokens = sequence_groups.front()->get_num_available_tokens_for_batching();
+    ASSERT_EQ(num_scheduled_tokens, num_validated_tokens + 1);
+    sequence_groups.front()->schedule_tokens(num_scheduled_tokens);
+
+    // the first branch is accepted up to [ 0, 1 ], the second one fully + bonus token [ 2 ]
+    std::vector<float> logits = {
+        0, 1.f, 0, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+        0, 0, 1.f, 0, 0,
+    };
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{6, 1, 5}, logits.data());
+
+    Sampler sampler;
+    auto sampler_output = sampler.sample(sequence_groups, logits_tensor, true);
+
+    const auto& sequences = sequence_groups.front()->get_sequences();
+    ASSERT_EQ(sequences.size(), 1);
+    ASSERT_EQ(sequences.front()->get_grouped_id(), 1);
+    TokenIds expected{0, 3, 4, 2};
+    ASSERT_EQ(sequences.front()->get_generated_ids(), expected);
+    ASSERT_NE(std::find(sampler_output.m_dropped_sequences.begin(), sampler_output.m_dropped_sequences.end(), sequence->get_id()),
+              sampler_output.m_dropped_sequences.end());
+}
+
+TEST(SamplerLogSoftmax, top_k_matches_full_log_softmax) {
+    std::vector<float> logits = {
+        0.5f, -1.f, 2.f, 0.f, 1.5f, 3.f,
+        1.f, 4.f, -2.f, 0.5f, 0.f, 2.5f,
+    };
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{2, 1, 6}, logits.data());
+
+    std::vector<Token> expected = log_softmax(logits_tensor, 1);
+    std::sort(expected.begin(), expected.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    });
+
+    std::vector<Token> tokens = log_softmax_top_k(logits_tensor, 1, 3);
+    ASSERT_EQ(tokens.size(), 3);
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        EXPECT_EQ(tokens[i].m_index, expected[i].m_index);
+        EXPECT_NEAR(tokens[i].m_log_prob, expected[i].m_log_prob, 1e-5f);
+    }
+}
+
+TEST(SamplerLogSoftmax, top_k_applies_adjustments) {
+    std::vector<float> logits = {0.f, 3.f, 2.f, 1.f};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 4}, logits.data());
+    std::vector<Token> full = log_softmax(logits_tensor, 0);
+
+    // the best token is banned and the second one is penalized below the fourth one
+    std::vector<Token> tokens = log_softmax_top_k(logits_tensor, 0, 2, {{1, -std::numeric_limits<float>::infinity()}, {2, -1.5f}});
+    ASSERT_EQ(tokens.size(), 2);
+    EXPECT_EQ(tokens[0].m_index, 3);
+    EXPECT_NEAR(tokens[0].m_log_prob, full[3].m_log_prob, 1e-5f);
+    EXPECT_EQ(tokens[1].m_index, 2);
+    EXPECT_NEAR(tokens[1].m_log_prob, full[2].m_log_prob - 1.5f, 1e-5f);
+}
+
+TEST(SamplerBeamSearch, bans_repeated_ngrams) {
+    auto sampling_config = ov::genai::utils::get_beam_search_config();
+    sampling_config.num_beams = 2;
+    sampling_config.num_beam_groups = 1;
+    sampling_config.num_return_sequences = 1;
+    sampling_config.diversity_penalty = 0.0f;
+    sampling_config.no_repeat_ngram_size = 2;
+    std::vector<int64_t> input_vector{0, 1, 2, 0};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 4}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+    sequence_groups.front()->set_output_seq_len(1);
+
+    // [ 0, 1 ] has already occurred, so the most probable token 1 must not follow the last token 0
+    std::vector<float> logits = {0, 5.f, 0, 2.f, 1.f};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 5}, logits.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, logits_tensor);
+
+    std::set<int64_t> next_tokens;
+    for (const auto& sequence : sequence_groups.front()->get_running_sequences()) {
+        ASSERT_EQ(sequence->get_generated_ids().size(), 1);
+        next_tokens.insert(sequence->get_generated_ids().front());
+    }
+    ASSERT_EQ(next_tokens, (std::set<int64_t>{3, 4}));
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the time to sample one token from a logits row (ns/row) for vocabulary sizes of 32k, 128k and 256k,
+// comparing FusedSamplingKernel with the TopKFilter -> TemperatureLogitTransform -> TopPFilter chain.
+// Usage: sampling_benchmark [num_iterations]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "sampling/fused_sampling.hpp"
+
+using namespace ov::genai;
+using namespace ov::genai::LogitTransformers;
+
+namespace {
+
+struct Scenario {
+    std::string name;
+    bool greedy;
+    FusedSamplingParams params;
+};
+
+// the transform chain with a draw over its result, as done by the sampler without the fused kernel
+int64_t sample_with_transforms(float* data, size_t size, const Scenario& scenario, std::mt19937& rng_engine) {
+    auto logits = Logits(data, size);
+    if (scenario.greedy) {
+        size_t max_index = 0;
+        for (size_t i = 1; i < size; ++i) {
+            if (data[i] > data[max_index]) {
+                max_index = i;
+            }
+        }
+        return static_cast<int64_t>(max_index);
+    }
+    const auto& params = scenario.params;
+    if (params.top_k > 0 && params.top_k < size) {
+        TopKFilter(params.top_k).apply(logits);
+    }
+    TemperatureLogitTransform(params.temperature).apply(logits);
+    if (params.top_p < 1.0f) {
+        TopPFilter(params.top_p).apply(logits);
+    }
+    auto prob_at = [&](size_t i) { return logits.is_vector_initialized() ? logits.m_vector[i].m_log_prob : logits.m_data[i]; };
+    float total_weight = 0.0f;
+    for (size_t i = 0; i < logits.m_size; ++i) {
+        total_weight += prob_at(i);
+    }
+    const float r = total_weight * std::uniform_real_distribution<float>(0.0f, 1.0f)(rng_engine);
+    float cumulative_weight = 0.0f;
+    size_t sampled_idx = logits.m_size - 1;
+    for (size_t i = 0; i < logits.m_size; ++i) {
+        cumulative_weight += prob_at(i);
+        if (cumulative_weight > r) {
+            sampled_idx = i;
+            break;
+        }
+    }
+    return logits.is_vector_initialized() ? logits.m_vector[sampled_idx].m_index : static_cast<int64_t>(sampled_idx);
+}
+
+int64_t sample_fused(FusedSamplingKernel& kernel, const float* data, size_t size, const Scenario& scenario,
+                     std::mt19937& rng_engine, std::vector<Token>& tokens) {
+    if (scenario.greedy) {
+        return static_cast<int64_t>(FusedSamplingKernel::argmax(data, size));
+    }
+    tokens.clear();
+    kernel.sample(data, size, scenario.params, 1, rng_engine, tokens);
+    return tokens.front().m_index;
+}
+
+template <typename Sample>
+double measure_ns_per_row(const std::vector<std::vector<float>>& rows, std::vector<float>& row_copy, size_t num_iterations,
+                          Sample&& sample) {
+    int64_t checksum = 0;
+    std::chrono::nanoseconds elapsed{0};
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration) {
+        const auto& row = rows[iteration % rows.size()];
+        // the transform chain modifies the row in place, so both variants sample from a fresh copy
+        std::copy(row.begin(), row.end(), row_copy.begin());
+        auto start = std::chrono::steady_clock::now();
+        checksum += sample(row_copy.data(), row_copy.size());
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+    // keep the results observable
+    if (checksum == -1) {
+        std::cout << checksum << std::endl;
+    }
+    return static_cast<double>(elapsed.count()) / num_iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t num_iterations = argc > 1 ? std::stoul(argv[1]) : 200;
+    const size_t no_top_k = std::numeric_limits<size_t>::max();
+    const std::vector<Scenario> scenarios = {
+        {"greedy", true, {}},
+        {"temperature=0.7", false, {no_top_k, 0.7f, 1.0f}},
+        {"top_k=50", false, {50, 1.0f, 1.0f}},
+        {"top_p=0.9", false, {no_top_k, 1.0f, 0.9f}},
+        {"top_k=50,top_p=0.9,T=0.7", false, {50, 0.7f, 0.9f}},
+    };
+
+    std::cout << std::left << std::setw(28) << "scenario" << std::setw(10) << "vocab"
+              << std::right << std::setw(16) << "chain ns/row" << std::setw(16) << "fused ns/row" << std::setw(10) << "speedup" << std::endl;
+    for (size_t vocab_size : {32000, 128000, 256000}) {
+        // a few different rows, roughly shaped like LM logits: a Gaussian bulk with a handful of strong tokens
+        std::mt19937 generator(vocab_size);
+        std::normal_distribution<float> bulk(0.0f, 2.0f);
+        std::uniform_int_distribution<size_t> position(0, vocab_size - 1);
+        std::vector<std::vector<float>> rows(8, std::vector<float>(vocab_size));
+        for (auto& row : rows) {
+            for (auto& value : row) {
+                value = bulk(generator);
+            }
+            for (size_t i = 0; i < 8; ++i) {
+                row[position(generator)] = 12.0f + i;
+            }
+        }
+        std::vector<float> row_copy(vocab_size);
+
+        for (const auto& scenario : scenarios) {
+            std::mt19937 rng_engine(42);
+            FusedSamplingKernel kernel;
+            std::vector<Token> tokens;
+            const double chain_ns = measure_ns_per_row(rows, row_copy, num_iterations, [&](float* data, size_t size) {
+                return sample_with_transforms(data, size, scenario, rng_engine);
+            });
+            const double fused_ns = measure_ns_per_row(rows, row_copy, num_iterations, [&](float* data, size_t size) {
+                return sample_fused(kernel, data, size, scenario, rng_engine, tokens);
+            });
+            std::cout << std::left << std::setw(28) << scenario.name << std::setw(10) << vocab_size
+                      << std::right << std::fixed << std::setprecision(0) << std::setw(16) << chain_ns << std::setw(16) << fused_ns
+                      << std::setprecision(2) << std::setw(9) << chain_ns / fused_ns << "x" << std::endl;
+        }
+    }
+    return 0;
+}
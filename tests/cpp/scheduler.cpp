@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include <gtest/gtest.h>
 #include "openvino/runtime/core.hpp"
 #include "openvino/op/concat.hpp"
@@ -1111,3 +1113,169 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 }
+
+TEST(TestScheduler, SwapsOutAndRestoresPreemptedSequenceGroup) {
+    auto scheduler_config = get_scheduler_config(32, 6, true, 5);
+    scheduler_config.preemption_mode = PreemptionMode::SWAP;
+    scheduler_config.swap_min_num_tokens = 0;
+    std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7,8,9,10};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()),
+                                                                            utils::get_greedy_config(), 4);
+    std::vector<uint64_t> tokens2 = {0,1,2,3,4,5,6,7};
+    auto idx0 = (*sequence_group1)[0]->get_id();
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()),
+                                                                            utils::get_greedy_config(), 4);
+    auto idx1 = (*sequence_group2)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config);
+    scheduler.schedule(requests);
+    for (auto seq: requests) {
+        seq->finish_iteration();
+    }
+
+    // schedule generate, all 6 kv blocks are used
+    scheduler.schedule(requests);
+    for (auto seq: requests) {
+        seq->get_running_sequences()[0]->append_token(16, 0.9);
+        seq->finish_iteration();
+    }
+
+    // mark the contents of the blocks of sequence_group2
+    ov::Tensor key_cache = cache_manager->get_key_cache(0);
+    const size_t block_stride = key_cache.get_byte_size() / key_cache.get_shape()[0];
+    auto block_data = [&](size_t block_idx) { return static_cast<uint8_t*>(key_cache.data()) + block_idx * block_stride; };
+    auto block_table2 = _get_indices(scheduler.get_block_tables(*(*sequence_group2)[0])[0]);
+    ASSERT_EQ(block_table2.size(), 3);
+    for (size_t i = 0; i < block_table2.size(); ++i) {
+        std::memset(block_data(block_table2[i]), static_cast<int>(i + 1), block_stride);
+    }
+
+    // sequence_group2 should be swapped out as a whole
+    auto out2 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids = {0};
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(scheduler.get_block_tables(*(*sequence_group1)[0])[0].size(), 4);
+    EXPECT_FALSE(scheduler.has_block_table(idx1));
+    // processed tokens are kept
+    EXPECT_EQ(sequence_group2->get_num_processed_tokens(), 9);
+
+    // finish first sequence
+    requests[0]->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(idx0);
+    clear_finished_sequences(requests);
+
+    // sequence_group2 should be swapped in and continue generation without recomputation
+    auto out3 = scheduler.schedule(requests);
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, 1);
+    ASSERT_TRUE(scheduler.has_block_table(idx1));
+    block_table2 = _get_indices(scheduler.get_block_tables(*(*sequence_group2)[0])[0]);
+    ASSERT_EQ(block_table2.size(), 3);
+    for (size_t i = 0; i < block_table2.size(); ++i) {
+        EXPECT_EQ(block_data(block_table2[i])[0], i + 1);
+        EXPECT_EQ(block_data(block_table2[i])[block_stride - 1], i + 1);
+    }
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, DoesNotSwapInGroupWhichRunningGroupsWouldPreempt) {
+    auto scheduler_config = get_scheduler_config(32, 7, true, 5);
+    scheduler_config.preemption_mode = PreemptionMode::SWAP;
+    scheduler_config.swap_min_num_tokens = 0;
+    std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7,8,9,10};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()),
+                                                                            utils::get_greedy_config(), 4);
+    std::vector<uint64_t> tokens2 = {0,1,2,3,4,5,6,7};
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()),
+                                                                            utils::get_greedy_config(), 4);
+    auto idx0 = (*sequence_group1)[0]->get_id();
+    auto idx1 = (*sequence_group2)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config);
+
+    // both groups grow until sequence_group2 is swapped out, then sequence_group1 keeps generating
+    // with just enough free blocks to resume sequence_group2, but not to let sequence_group1 grow as well
+    size_t num_preempted = 0;
+    for (size_t step = 0; step < 12; ++step) {
+        auto out = scheduler.schedule(requests);
+        num_preempted += out.m_num_preempted_sequence_groups;
+        for (size_t seq_group_id : out.m_scheduled_sequence_groups_ids) {
+            requests[seq_group_id]->get_running_sequences()[0]->append_token(16, 0.9);
+        }
+        for (auto& request : requests) {
+            request->finish_iteration();
+        }
+        EXPECT_TRUE(scheduler.has_block_table(idx0));
+    }
+    // a resumed group would be swapped out again at each step
+    EXPECT_EQ(num_preempted, 1);
+    EXPECT_FALSE(scheduler.has_block_table(idx1));
+
+    // blocks of the finished group are enough to resume the swapped one
+    requests[0]->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(idx0);
+    clear_finished_sequences(requests);
+    auto out = scheduler.schedule(requests);
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, 1);
+    EXPECT_TRUE(scheduler.has_block_table(idx1));
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, SchedulesAndPreemptsByPriority) {
+    auto scheduler_config = get_scheduler_config(32, 6, true, 5);
+    std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7,8,9,10};
+    auto bulk_config = utils::get_greedy_config();
+    SequenceGroup::Ptr bulk_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()),
+                                                                    bulk_config, 4);
+    std::vector<uint64_t> tokens2 = {0,1,2,3,4,5,6,7};
+    auto interactive_config = utils::get_greedy_config();
+    interactive_config.priority = 1;
+    SequenceGroup::Ptr interactive_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()),
+                                                                           interactive_config, 4);
+    auto bulk_seq_id = (*bulk_group)[0]->get_id();
+    auto interactive_seq_id = (*interactive_group)[0]->get_id();
+    // the interactive request comes last, but is served first
+    std::vector<SequenceGroup::Ptr> requests = {bulk_group, interactive_group};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(requests[0], interactive_group);
+    ASSERT_EQ(out1.m_scheduled_sequence_groups_ids.size(), 2);
+    EXPECT_EQ(requests[out1.m_scheduled_sequence_groups_ids[0]], interactive_group);
+    for (auto seq: requests) {
+        seq->finish_iteration();
+    }
+
+    // schedule generate, all 6 kv blocks are used
+    scheduler.schedule(requests);
+    for (auto seq: requests) {
+        seq->get_running_sequences()[0]->append_token(16, 0.9);
+        seq->finish_iteration();
+    }
+
+    // the bulk request needs a new block, but can't preempt the interactive one
+    auto out2 = scheduler.schedule(requests);
+    ASSERT_EQ(out2.m_scheduled_sequence_groups_ids.size(), 1);
+    EXPECT_EQ(requests[out2.m_scheduled_sequence_groups_ids[0]], interactive_group);
+    EXPECT_EQ(scheduler.get_block_tables(interactive_seq_id)[0].size(), 3);
+    EXPECT_EQ(scheduler.get_block_tables(bulk_seq_id)[0].size(), 3);
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/slo_tracker.hpp"
+
+using namespace ov::genai;
+using namespace std::chrono_literals;
+
+TEST(SLOTrackerTest, CountsTimeToFirstTokenFromArrival) {
+    SLOTracker tracker;
+    const auto start = SLOTracker::Clock::now();
+    tracker.update(0, 0, start);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 30ms), 70.0);
+    // prompt processing doesn't reset the deadline
+    tracker.update(0, 0, start + 50ms);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 120ms), -20.0);
+    EXPECT_EQ(tracker.get_slack_ms(0, 0, 10, start + 120ms), SLOTracker::NO_DEADLINE);
+}
+
+TEST(SLOTrackerTest, CountsTimePerOutputTokenFromLastToken) {
+    SLOTracker tracker;
+    const auto start = SLOTracker::Clock::now();
+    tracker.update(0, 0, start);
+    tracker.update(0, 1, start + 40ms);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 45ms), 5.0);
+    // no progress
+    tracker.update(0, 1, start + 60ms);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 60ms), -10.0);
+    tracker.update(0, 3, start + 70ms);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 70ms), 10.0);
+    EXPECT_EQ(tracker.get_slack_ms(0, 100, 0, start + 70ms), SLOTracker::NO_DEADLINE);
+}
+
+TEST(SLOTrackerTest, ForgetsFinishedRequests) {
+    SLOTracker tracker;
+    const auto start = SLOTracker::Clock::now();
+    tracker.update(0, 0, start);
+    tracker.update(1, 0, start);
+    tracker.retain({1});
+    EXPECT_EQ(tracker.get_slack_ms(0, 100, 10, start), SLOTracker::NO_DEADLINE);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(1, 100, 10, start), 100.0);
+    // a forgotten request starts over when seen again
+    tracker.update(0, 0, start + 10ms);
+    EXPECT_DOUBLE_EQ(tracker.get_slack_ms(0, 100, 10, start + 10ms), 100.0);
+}
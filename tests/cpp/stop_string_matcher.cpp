@@ -0,0 +1,129 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "sampling/stop_string_matcher.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// token id -> text; the last token can't be decoded in isolation
+std::shared_ptr<const StopStringMatcher::DecodedVocab> make_vocab() {
+    return std::make_shared<StopStringMatcher::DecodedVocab>(StopStringMatcher::DecodedVocab{
+        "Hello", " world", "!", " ", "\n", "<", "stop", ">", "st", "op", "a", std::nullopt});
+}
+
+enum : int64_t { HELLO, WORLD, BANG, SPACE, NEWLINE, LT, STOP, GT, ST, OP, A, PARTIAL };
+}
+
+TEST(StopStringMatcherTest, MatchesStopStringSpanningTokens) {
+    StopStringMatcher matcher({"<stop>"}, make_vocab(), 3);
+    std::vector<int64_t> tokens = {HELLO, WORLD, SPACE, LT, ST};
+    auto result = matcher.match(0, tokens, false);
+    EXPECT_TRUE(result.is_reliable);
+    EXPECT_FALSE(result.is_matched);
+
+    tokens.insert(tokens.end(), {OP, GT, A});
+    result = matcher.match(0, tokens, false);
+    ASSERT_TRUE(result.is_matched);
+    // "Hello world" is kept: the trailing space is trimmed
+    EXPECT_EQ(result.to_remove, 6);
+
+    StopStringMatcher including_matcher({"<stop>"}, make_vocab(), 3);
+    result = including_matcher.match(0, tokens, true);
+    ASSERT_TRUE(result.is_matched);
+    // "Hello world <stop>" is kept
+    EXPECT_EQ(result.to_remove, 1);
+}
+
+TEST(StopStringMatcherTest, PrefersEarliestAndLongestMatch) {
+    StopStringMatcher matcher({"stop", "<stop", "!"}, make_vocab(), 3);
+    auto result = matcher.match(0, {HELLO, LT, STOP, BANG}, false);
+    ASSERT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 3);
+
+    result = matcher.match(1, {HELLO, BANG, LT, STOP}, true);
+    ASSERT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 2);
+}
+
+TEST(StopStringMatcherTest, FollowsRolledBackTokens) {
+    StopStringMatcher matcher({"<stop>"}, make_vocab(), 3);
+    EXPECT_FALSE(matcher.match(0, {HELLO, LT, STOP}, false).is_matched);
+    // candidate token is checked without being remembered
+    EXPECT_TRUE(matcher.match(0, {HELLO, LT, STOP}, false, GT).is_matched);
+    EXPECT_FALSE(matcher.match(0, {HELLO, LT, STOP}, false, BANG).is_matched);
+    // tail replaced after validation
+    EXPECT_FALSE(matcher.match(0, {HELLO, LT, A, GT}, false).is_matched);
+    auto result = matcher.match(0, {HELLO, LT, STOP, GT}, false);
+    ASSERT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 3);
+}
+
+TEST(StopStringMatcherTest, ReportsInexactTokensNearTheTail) {
+    StopStringMatcher matcher({"<stop>"}, make_vocab(), 2);
+    std::vector<int64_t> tokens = {HELLO, PARTIAL, WORLD};
+    EXPECT_FALSE(matcher.match(0, tokens, false).is_reliable);
+    // a stop string ending in the new tokens could still start in the inexact one
+    tokens.insert(tokens.end(), {A, A, A});
+    EXPECT_FALSE(matcher.match(0, tokens, false).is_reliable);
+    tokens.push_back(A);
+    EXPECT_TRUE(matcher.match(0, tokens, false).is_reliable);
+    // out of vocabulary tokens are treated the same way
+    tokens.push_back(100);
+    EXPECT_FALSE(matcher.match(0, tokens, false).is_reliable);
+    tokens.pop_back();
+    EXPECT_TRUE(matcher.match(0, tokens, false).is_reliable);
+}
+
+TEST(StopStringMatcherTest, AgreesWithTextSearch) {
+    const auto vocab = make_vocab();
+    const std::set<std::string> stop_strings = {"<stop>", "o!", "d\n", "st"};
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int64_t> token_distribution(HELLO, A);
+    for (size_t iteration = 0; iteration < 200; ++iteration) {
+        StopStringMatcher matcher(stop_strings, vocab, 4);
+        std::vector<int64_t> tokens;
+        std::string text;
+        for (size_t step = 0; step < 20; ++step) {
+            const int64_t token = token_distribution(generator);
+            tokens.push_back(token);
+            const size_t checked = text.size();
+            text += *(*vocab)[token];
+
+            // the first stop string occurrence ending in the new text
+            size_t expected_end = std::string::npos, expected_start = 0;
+            for (const auto& stop_string : stop_strings) {
+                for (size_t pos = text.find(stop_string); pos != std::string::npos; pos = text.find(stop_string, pos + 1)) {
+                    const size_t end = pos + stop_string.size();
+                    if (end > checked && (end < expected_end || (end == expected_end && pos < expected_start))) {
+                        expected_end = end;
+                        expected_start = pos;
+                    }
+                }
+            }
+
+            const auto result = matcher.match(0, tokens, false);
+            ASSERT_TRUE(result.is_reliable);
+            ASSERT_EQ(result.is_matched, expected_end != std::string::npos);
+            if (result.is_matched) {
+                std::string kept = text.substr(0, expected_start);
+                while (!kept.empty() && (kept.back() == ' ' || kept.back() == '\n')) {
+                    kept.pop_back();
+                }
+                std::string kept_tokens_text;
+                for (size_t i = 0; i < tokens.size() - result.to_remove; ++i) {
+                    kept_tokens_text += *(*vocab)[tokens[i]];
+                }
+                // the minimal number of tokens covering the kept text
+                EXPECT_EQ(kept_tokens_text.compare(0, kept.size(), kept), 0);
+                EXPECT_TRUE(tokens.size() - result.to_remove == 0 ||
+                            kept_tokens_text.size() - (*(*vocab)[tokens[tokens.size() - result.to_remove - 1]]).size() < kept.size());
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/threaded_streamer.hpp"
+
+using namespace ov::genai;
+
+namespace {
+class RecordingStreamer : public StreamerBase {
+public:
+    explicit RecordingStreamer(size_t max_tokens = std::numeric_limits<size_t>::max()) : m_max_tokens(max_tokens) {}
+
+    StreamingStatus write(int64_t token) override {
+        m_tokens.push_back(token);
+        return m_tokens.size() >= m_max_tokens ? StreamingStatus::STOP : StreamingStatus::RUNNING;
+    }
+
+    StreamingStatus write(const std::vector<int64_t>& tokens) override {
+        m_tokens.insert(m_tokens.end(), tokens.begin(), tokens.end());
+        return m_tokens.size() >= m_max_tokens ? StreamingStatus::STOP : StreamingStatus::RUNNING;
+    }
+
+    void end() override {
+        m_num_end_calls++;
+    }
+
+    std::vector<int64_t> m_tokens;
+    size_t m_num_end_calls = 0;
+    size_t m_max_tokens;
+};
+}
+
+TEST(ThreadedBatchStreamerWrapperTest, StreamsEachRequestToItsStreamer) {
+    auto first = std::make_shared<RecordingStreamer>();
+    auto third = std::make_shared<RecordingStreamer>();
+    Tokenizer tokenizer;
+    ThreadedBatchStreamerWrapper streamer({first, std::monostate{}, third}, tokenizer);
+    ASSERT_TRUE(streamer.has_callbacks());
+    EXPECT_FALSE(streamer.has_callback(1));
+
+    streamer.start();
+    streamer.write(0, {1, 2});
+    streamer.write(1, {3});
+    streamer.write(2, {4});
+    streamer.end_request(0);
+    // tokens of an ended request are dropped
+    streamer.write(0, {5});
+    streamer.write(2, {6, 7});
+    streamer.end();
+
+    EXPECT_EQ(first->m_tokens, std::vector<int64_t>({1, 2}));
+    EXPECT_EQ(third->m_tokens, std::vector<int64_t>({4, 6, 7}));
+    EXPECT_EQ(first->m_num_end_calls, 1);
+    EXPECT_EQ(third->m_num_end_calls, 1);
+}
+
+TEST(ThreadedBatchStreamerWrapperTest, StopsOnlyTheRequestWhichAskedForIt) {
+    auto stopping = std::make_shared<RecordingStreamer>(2);
+    auto running = std::make_shared<RecordingStreamer>();
+    Tokenizer tokenizer;
+    ThreadedBatchStreamerWrapper streamer({stopping, running}, tokenizer);
+
+    streamer.start();
+    streamer.write(0, {1, 2});
+    streamer.write(1, {1, 2});
+    streamer.write(0, {3});
+    streamer.write(1, {3});
+    streamer.end();
+
+    EXPECT_EQ(streamer.get_status(0), StreamingStatus::STOP);
+    EXPECT_EQ(streamer.get_status(1), StreamingStatus::RUNNING);
+    EXPECT_EQ(stopping->m_tokens, std::vector<int64_t>({1, 2}));
+    EXPECT_EQ(running->m_tokens, std::vector<int64_t>({1, 2, 3}));
+}
+
+TEST(ThreadedBatchStreamerWrapperTest, DoesNothingWithoutStreamers) {
+    Tokenizer tokenizer;
+    ThreadedBatchStreamerWrapper streamer({std::monostate{}, std::monostate{}}, tokenizer);
+    EXPECT_FALSE(streamer.has_callbacks());
+    streamer.start();
+    streamer.write(0, {1});
+    streamer.end();
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "sampling/threadpool.hpp"
+
+TEST(TestThreadPool, parallel_for_processes_each_item_once) {
+    ThreadPool pool(3);
+    for (size_t num_items : {0, 1, 5, 256, 1001}) {
+        for (size_t chunk_size : {1, 8, 64}) {
+            std::vector<std::atomic<size_t>> visits(num_items);
+            pool.parallel_for(num_items, [&](size_t begin, size_t end) {
+                ASSERT_LT(begin, end);
+                ASSERT_LE(end, num_items);
+                ASSERT_LE(end - begin, chunk_size);
+                for (size_t i = begin; i < end; ++i) {
+                    visits[i]++;
+                }
+            }, chunk_size);
+            for (size_t i = 0; i < num_items; ++i) {
+                EXPECT_EQ(visits[i], 1) << "item " << i << ", " << num_items << " items, chunk " << chunk_size;
+            }
+        }
+    }
+}
+
+TEST(TestThreadPool, parallel_for_steals_from_slow_participant) {
+    ThreadPool pool(3);
+    const size_t num_items = 64;
+    std::atomic<size_t> num_processed{0};
+    std::vector<std::thread::id> processed_by(num_items);
+    pool.parallel_for(num_items, [&](size_t begin, size_t end) {
+        // the first item is very slow: the rest of its owner's range must be taken over by the others
+        if (begin == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        for (size_t i = begin; i < end; ++i) {
+            processed_by[i] = std::this_thread::get_id();
+            num_processed++;
+        }
+    });
+    EXPECT_EQ(num_processed, num_items);
+    size_t num_processed_by_owner = 0;
+    for (size_t i = 0; i < num_items / 4; ++i) {
+        num_processed_by_owner += processed_by[i] == processed_by[0];
+    }
+    EXPECT_LT(num_processed_by_owner, num_items / 4);
+}
+
+TEST(TestThreadPool, parallel_for_propagates_exceptions) {
+    ThreadPool pool(2);
+    std::atomic<size_t> num_processed{0};
+    EXPECT_THROW(pool.parallel_for(100, [&](size_t begin, size_t end) {
+        num_processed += end - begin;
+        if (begin == 50) {
+            throw std::runtime_error("failure");
+        }
+    }), std::runtime_error);
+    // the pool stays usable
+    num_processed = 0;
+    pool.parallel_for(100, [&](size_t begin, size_t end) { num_processed += end - begin; });
+    EXPECT_EQ(num_processed, 100);
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/tokenization_cache.hpp"
+
+using namespace ov::genai;
+
+TEST(TokenizationCacheTest, SplitsBySpecialTokens) {
+    TokenizationCache cache(100);
+    cache.set_special_tokens({{"<|im_start|>", 1}, {"<|im_end|>", 2}, {"<|im", 3}});
+
+    const auto segments = cache.split("<|im_start|>system\nBe brief<|im_end|>\n<|im_start|>user\nHi <|im");
+    ASSERT_EQ(segments.size(), 7);
+    // the longest special token wins
+    EXPECT_EQ(segments[0].special_token_id, 1);
+    EXPECT_EQ(segments[1].text, "system\nBe brief");
+    EXPECT_EQ(segments[1].special_token_id, -1);
+    EXPECT_EQ(segments[2].special_token_id, 2);
+    EXPECT_EQ(segments[3].text, "\n");
+    EXPECT_EQ(segments[4].special_token_id, 1);
+    EXPECT_EQ(segments[5].text, "user\nHi ");
+    EXPECT_EQ(segments[6].special_token_id, 3);
+
+    EXPECT_EQ(cache.split("plain text").size(), 1);
+}
+
+TEST(TokenizationCacheTest, EvictsLeastRecentlyUsed) {
+    TokenizationCache cache(5);
+    std::vector<int64_t> token_ids;
+    EXPECT_FALSE(cache.append_cached("a", token_ids));
+    cache.put("a", {1, 2});
+    cache.put("b", {3, 4});
+    EXPECT_TRUE(cache.append_cached("a", token_ids));
+    EXPECT_EQ(token_ids, std::vector<int64_t>({1, 2}));
+
+    // "b" is the least recently used
+    cache.put("c", {5, 6});
+    EXPECT_FALSE(cache.append_cached("b", token_ids));
+    EXPECT_TRUE(cache.append_cached("c", token_ids));
+    EXPECT_EQ(token_ids, std::vector<int64_t>({1, 2, 5, 6}));
+
+    // doesn't fit into the budget
+    cache.put("d", {1, 2, 3, 4, 5, 6});
+    EXPECT_FALSE(cache.append_cached("d", token_ids));
+
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 3);
+    EXPECT_EQ(stats.num_cached_tokens, 4);
+    EXPECT_FLOAT_EQ(stats.get_hit_rate(), 0.4f);
+
+    cache.clear();
+    EXPECT_EQ(cache.get_stats().num_cached_tokens, 0);
+    EXPECT_FALSE(cache.append_cached("a", token_ids));
+}
+
+TEST(TokenizationCacheTest, SplitsOnlyAtTokensWhichKeepTokenization) {
+    // Qwen2-like byte-level BPE
+    auto tokenizer_json = nlohmann::json::parse(R"({
+        "added_tokens": [
+            {"content": "<|im_start|>", "single_word": false, "lstrip": false, "rstrip": false, "normalized": false, "special": true},
+            {"content": "<|im_end|>", "single_word": false, "lstrip": false, "rstrip": false, "normalized": false, "special": true},
+            {"content": "<|endoftext|>", "single_word": false, "lstrip": false, "rstrip": true, "normalized": false, "special": true},
+            {"content": "<mask>", "single_word": false, "lstrip": false, "rstrip": false, "normalized": true, "special": true}
+        ],
+        "normalizer": {"type": "NFC"},
+        "pre_tokenizer": {"type": "Sequence", "pretokenizers": [
+            {"type": "Split", "pattern": {"Regex": "\\s+"}, "behavior": "Isolated", "invert": false},
+            {"type": "ByteLevel", "add_prefix_space": false, "trim_offsets": false, "use_regex": false}
+        ]}
+    })");
+    const auto added_tokens = get_splittable_added_tokens(tokenizer_json, nlohmann::json::object());
+    ASSERT_TRUE(added_tokens.has_value());
+    EXPECT_EQ(*added_tokens, std::unordered_set<std::string>({"<|im_start|>", "<|im_end|>"}));
+
+    EXPECT_FALSE(get_splittable_added_tokens(tokenizer_json, nlohmann::json{{"add_prefix_space", true}}).has_value());
+    EXPECT_FALSE(get_splittable_added_tokens(nlohmann::json::object(), nlohmann::json::object()).has_value());
+}
+
+TEST(TokenizationCacheTest, DoesNotSplitTextWithDummyPrefix) {
+    auto tokenizer_json = nlohmann::json::parse(R"({
+        "added_tokens": [
+            {"content": "</s>", "single_word": false, "lstrip": false, "rstrip": false, "normalized": false, "special": true}
+        ],
+        "normalizer": null,
+        "pre_tokenizer": {"type": "Metaspace", "replacement": "▁", "prepend_scheme": "first", "split": false}
+    })");
+    EXPECT_FALSE(get_splittable_added_tokens(tokenizer_json, nlohmann::json::object()).has_value());
+
+    tokenizer_json["pre_tokenizer"]["prepend_scheme"] = "never";
+    EXPECT_TRUE(get_splittable_added_tokens(tokenizer_json, nlohmann::json::object()).has_value());
+    EXPECT_FALSE(get_splittable_added_tokens(tokenizer_json, nlohmann::json{{"legacy", false}}).has_value());
+
+    // Llama normalizer prepends the SentencePiece dummy prefix
+    tokenizer_json["normalizer"] = nlohmann::json::parse(R"({"type": "Sequence", "normalizers": [
+        {"type": "Prepend", "prepend": "▁"},
+        {"type": "Replace", "pattern": {"String": " "}, "content": "▁"}
+    ]})");
+    EXPECT_FALSE(get_splittable_added_tokens(tokenizer_json, nlohmann::json::object()).has_value());
+}
@@ -3,6 +3,9 @@
 //
 
 #include <gtest/gtest.h>
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
 #include "utils.hpp"
 
 
@@ -19,3 +22,37 @@ TEST(TestIsContainer, test_is_container) {
     EXPECT_EQ(is_container<map_type>, true);
     EXPECT_EQ(is_container<std::set<int64_t>>, true);
 }
+
+TEST(TestStableHash, matches_xxh64_reference) {
+    const std::string empty;
+    const std::string short_input = "abc";
+    const std::string long_input = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(stable_hash(empty.data(), empty.size()), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(stable_hash(short_input.data(), short_input.size()), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(stable_hash(long_input.data(), long_input.size()), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(TestModelFingerprint, depends_on_weights) {
+    auto make_model = [](float weight) {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{2}, {1.f, weight});
+        auto add = std::make_shared<ov::op::v1::Add>(input, constant);
+        return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    };
+    EXPECT_EQ(get_model_fingerprint(make_model(2.f)), get_model_fingerprint(make_model(2.f)));
+    EXPECT_NE(get_model_fingerprint(make_model(2.f)), get_model_fingerprint(make_model(3.f)));
+}
+
+TEST(TestModelFingerprint, samples_large_weights) {
+    auto make_model = [](size_t changed_idx) {
+        std::vector<float> weights(1 << 16, 1.f);
+        weights[changed_idx] = 2.f;
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{weights.size()});
+        auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{weights.size()}, weights);
+        auto add = std::make_shared<ov::op::v1::Add>(input, constant);
+        return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    };
+    // the first and the last bytes are always sampled
+    EXPECT_NE(get_model_fingerprint(make_model(0)), get_model_fingerprint(make_model(1)));
+    EXPECT_NE(get_model_fingerprint(make_model((1 << 16) - 1)), get_model_fingerprint(make_model(1)));
+}
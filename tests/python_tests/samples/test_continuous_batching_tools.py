@@ -25,7 +25,8 @@ class TestContinuousBatching:
     @pytest.mark.samples
     @pytest.mark.parametrize("convert_model", ["TinyLlama-1.1B-Chat-v1.0"], indirect=True)
     @pytest.mark.parametrize("download_test_content", ["ShareGPT_V3_unfiltered_cleaned_split.json"], indirect=True)
-    @pytest.mark.parametrize("sample_args", [["-n", "10", "--cache_size", "1"], ["-n", "10", "--dynamic_split_fuse", "--max_batch_size", "256", "--max_input_len", "256", "--cache_size", "1"]])
+    @pytest.mark.parametrize("sample_args", [["-n", "10", "--cache_size", "1"], ["-n", "10", "--dynamic_split_fuse", "--max_batch_size", "256", "--max_input_len", "256", "--cache_size", "1"],
+                                             ["-n", "10", "--cache_size", "1", "--request_rate", "4,8", "--arrival_process", "gamma", "--burstiness", "0.5", "--slo_ttft", "1000", "--slo_tpot", "100"]])
     def test_cpp_tool_benchmark(self, convert_model, download_test_content, sample_args):
         # Test CPP sample
         cpp_sample = SAMPLES_CPP_DIR / 'continuous_batching_benchmark'
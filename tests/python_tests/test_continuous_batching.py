@@ -10,7 +10,8 @@ from pathlib import Path
 from shutil import rmtree
 
 import openvino as ov
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason, ChatHistory
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason, ChatHistory, \
+    Adapter, AdapterConfig
 
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
 
@@ -154,6 +155,26 @@ def test_cb_streamer_vs_return_vs_stateful(model_facebook_opt_125m: OVConvertedM
     assert "".join(streamed) == reference
 
 
+def test_cb_per_request_streamers(model_facebook_opt_125m: OVConvertedModelSchema):
+    cb_pipe = ContinuousBatchingPipeline(model_facebook_opt_125m.models_path, SchedulerConfig(), "CPU")
+    prompts = ['The Sun is yellow because', 'Difference between Jupiter and Mars is that', 'table is made of']
+    generation_configs = [GenerationConfig(max_new_tokens=max_new_tokens) for max_new_tokens in [20, 15, 10]]
+
+    streamed = [[], [], []]
+    streamers = [lambda subword: streamed[0].append(subword), None, lambda subword: streamed[2].append(subword)]
+    results = cb_pipe.generate(prompts, generation_configs, streamers)
+    reference = cb_pipe.generate(prompts, generation_configs)
+
+    for result, ref_result in zip(results, reference):
+        assert result.m_generation_ids == ref_result.m_generation_ids
+    assert "".join(streamed[0]) == results[0].m_generation_ids[0]
+    assert not streamed[1]
+    assert "".join(streamed[2]) == results[2].m_generation_ids[0]
+
+    with pytest.raises(RuntimeError, match="Number of streamers"):
+        cb_pipe.generate(prompts, generation_configs, streamers[:2])
+
+
 @pytest.mark.parametrize(
     "generation_config_kwargs", 
     [
@@ -341,6 +362,13 @@ def test_post_oom_health(model_facebook_opt_125m: OVConvertedModelSchema, sampli
 # Pre-emption
 #
 
+def test_assistant_branches_rejected_without_draft_model(model_facebook_opt_125m: OVConvertedModelSchema):
+    pipe = ContinuousBatchingPipeline(model_facebook_opt_125m.models_path, SchedulerConfig(), "CPU")
+    generation_config = GenerationConfig(max_new_tokens=10, num_assistant_branches=2)
+    with pytest.raises(RuntimeError, match="num_assistant_branches"):
+        pipe.generate(["What is OpenVINO?"], [generation_config])
+
+
 def get_parallel_sampling_seq_len_300() -> GenerationConfig:
     generation_config = GenerationConfig()
     # TODO: add generation_config.generator and return parameters below
@@ -739,6 +767,82 @@ def test_dynamic_split_fuse_for_eagle3():
     compare_results_for_dynamic_split_fuse_config("Qwen/Qwen3-1.7B", "AngelSlim/Qwen3-1.7B_eagle3")
 
 
+def test_pipelined_speculative_decoding_matches_sequential():
+    main_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-360M").models_path
+    draft_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-135M").models_path
+
+    def create_pipe(pipelined: bool) -> ContinuousBatchingPipeline:
+        properties = {"draft_model": draft_model(draft_model_path), "pipelined_speculative_decoding": pipelined}
+        return ContinuousBatchingPipeline(main_model_path, SchedulerConfig(), "CPU", properties)
+
+    def run(pipe: ContinuousBatchingPipeline, generation_configs: list[GenerationConfig]):
+        handles = [pipe.add_request(idx, question, generation_config=config)
+                   for idx, (question, config) in enumerate(zip(COMMON_QUESTIONS, generation_configs))]
+        while pipe.has_non_finished_requests():
+            pipe.step()
+        return [[(output.generated_ids, output.finish_reason) for output in handle.read_all()] for handle in handles]
+
+    # max_new_tokens are not multiples of the validation window (num_assistant_tokens + 1),
+    # so requests reach the limit in the middle of a window
+    generation_configs = [GenerationConfig(do_sample=False, max_new_tokens=max_new_tokens, num_assistant_tokens=4)
+                          for max_new_tokens in [20, 7, 13, 20]]
+
+    sequential_pipe = create_pipe(pipelined=False)
+    # the first request is stopped by a token it generates in the middle of a window
+    generated_ids = run(sequential_pipe, generation_configs)[0][0][0]
+    generation_configs[0].stop_token_ids = {generated_ids[6]}
+    reference = run(sequential_pipe, generation_configs)
+    del sequential_pipe
+
+    pipelined_pipe = create_pipe(pipelined=True)
+    results = run(pipelined_pipe, generation_configs)
+    del pipelined_pipe
+
+    assert reference[0][0][1] == GenerationFinishReason.STOP
+    assert results == reference
+
+
+
+def test_assistant_branches_match_greedy():
+    main_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-360M").models_path
+    draft_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-135M").models_path
+
+    # enough tokens for validation windows of forked branches to cross KV cache block boundaries
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=100, ignore_eos=True)
+    reference_pipe = ContinuousBatchingPipeline(main_model_path, SchedulerConfig(), "CPU")
+    reference = reference_pipe.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    del reference_pipe
+
+    generation_config.num_assistant_tokens = 5
+    generation_config.num_assistant_branches = 2
+    pipe = ContinuousBatchingPipeline(main_model_path, SchedulerConfig(), "CPU", {"draft_model": draft_model(draft_model_path)})
+    results = pipe.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    del pipe
+
+    assert [result.m_generation_ids for result in results] == [result.m_generation_ids for result in reference]
+
+
+@pytest.mark.parametrize("pipelined", [False, True])
+def test_adaptive_speculation_matches_greedy(pipelined: bool):
+    # draft model is slower than main one, so speculation never pays off: requests fall back to plain decoding
+    # after the first iterations and probe speculation periodically, which makes draft model catch up with main one
+    main_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-135M").models_path
+    draft_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-360M").models_path
+
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=60, ignore_eos=True)
+    reference_pipe = ContinuousBatchingPipeline(main_model_path, SchedulerConfig(), "CPU")
+    reference = reference_pipe.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    del reference_pipe
+
+    generation_config.num_assistant_tokens = 5
+    generation_config.adaptive_num_assistant_tokens = True
+    properties = {"draft_model": draft_model(draft_model_path), "pipelined_speculative_decoding": pipelined}
+    pipe = ContinuousBatchingPipeline(main_model_path, SchedulerConfig(), "CPU", properties)
+    results = pipe.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    del pipe
+
+    assert [result.m_generation_ids for result in results] == [result.m_generation_ids for result in reference]
+
 @pytest.fixture(scope="module")
 def cb_model(request: pytest.FixtureRequest) -> OVConvertedModelSchema:
     return download_and_convert_model(request.param)
@@ -784,3 +888,50 @@ def test_continuous_batching_add_extension(
     assert result_extension_obj[0].m_generation_ids[0].strip() == result_ref[0].m_generation_ids[0].strip(), (
         "Result should be the same for model with extension 'CustomAdd' and reference model."
     )
+
+
+def make_random_lora_adapter(path: Path, seed: int, hidden_size: int = 768, num_layers: int = 12, rank: int = 8) -> Path:
+    import numpy as np
+    from safetensors.numpy import save_file
+
+    rng = np.random.default_rng(seed)
+    tensors = {}
+    for layer in range(num_layers):
+        for proj in ["q_proj", "v_proj"]:
+            prefix = f"base_model.model.model.decoder.layers.{layer}.self_attn.{proj}"
+            tensors[f"{prefix}.lora_A.weight"] = rng.standard_normal((rank, hidden_size), dtype=np.float32) * 0.05
+            tensors[f"{prefix}.lora_B.weight"] = rng.standard_normal((hidden_size, rank), dtype=np.float32) * 0.05
+    save_file(tensors, str(path))
+    return path
+
+
+def test_per_request_adapters_in_one_batch(model_facebook_opt_125m: OVConvertedModelSchema, tmp_path: Path):
+    models_path = model_facebook_opt_125m.models_path
+    adapter_a = Adapter(make_random_lora_adapter(tmp_path / "adapter_a.safetensors", seed=1))
+    adapter_b = Adapter(make_random_lora_adapter(tmp_path / "adapter_b.safetensors", seed=2))
+    prompts = ["What is OpenVINO?", "The Sun is yellow because", "1+1="]
+    request_adapters = [AdapterConfig(adapter_a), AdapterConfig(adapter_b, 0.5), None]
+
+    def get_config(adapters):
+        config = GenerationConfig(max_new_tokens=20)
+        config.adapters = adapters
+        return config
+
+    # all requests are scheduled in the same step with different adapters or without an adapter at all
+    pipe = ContinuousBatchingPipeline(models_path, SchedulerConfig(), "CPU",
+                                      properties={"adapters": AdapterConfig([adapter_a, adapter_b]), "per_request_adapters": True})
+    results = pipe.generate(prompts, [get_config(adapters) for adapters in request_adapters])
+    del pipe
+
+    for prompt, adapters, result in zip(prompts, request_adapters, results):
+        properties = {"adapters": adapters} if adapters is not None else {}
+        ref_pipe = ContinuousBatchingPipeline(models_path, SchedulerConfig(), "CPU", properties=properties)
+        ref_result = ref_pipe.generate([prompt], [get_config(adapters)])[0]
+        assert result.m_generation_ids == ref_result.m_generation_ids
+        del ref_pipe
+
+
+def test_per_request_adapters_require_adapters(model_facebook_opt_125m: OVConvertedModelSchema):
+    with pytest.raises(RuntimeError, match="per_request_adapters"):
+        ContinuousBatchingPipeline(model_facebook_opt_125m.models_path, SchedulerConfig(), "CPU",
+                                   properties={"per_request_adapters": True})
@@ -701,9 +701,59 @@ def test_fixed_shapes_configs(emb_model, dataset_documents, config, dataset_embe
 @pytest.mark.parametrize(
     "config",
     [
-        TextEmbeddingPipeline.Config(batch_size=0),
+        TextEmbeddingPipeline.Config(max_batch_tokens=1),
+        TextEmbeddingPipeline.Config(max_batch_tokens=256),
+        TextEmbeddingPipeline.Config(max_batch_tokens=256, padding_side="left"),
+        TextEmbeddingPipeline.Config(max_batch_tokens=0),
+        TextEmbeddingPipeline.Config(batch_size=4),
         # more than documents in dataset (9)
         TextEmbeddingPipeline.Config(batch_size=10),
+    ],
+)
+def test_micro_batches(emb_model, dataset_documents, config, dataset_embeddings_genai_default_config_refs):
+    models_path = emb_model.models_path
+
+    # all documents are embedded regardless of batch_size
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config)
+    result = pipeline.embed_documents(dataset_documents)
+    validate_embedding_results(dataset_embeddings_genai_default_config_refs, result)
+
+
+@pytest.mark.parametrize("emb_model", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize("embedding_dimensions", [None, 128])
+def test_embedding_types(emb_model, dataset_documents, embedding_dimensions, dataset_embeddings_genai_default_config_refs):
+    models_path = emb_model.models_path
+    refs = np.array(dataset_embeddings_genai_default_config_refs)
+    if embedding_dimensions:
+        refs = refs[:, :embedding_dimensions]
+        refs /= np.linalg.norm(refs, axis=1, keepdims=True)
+
+    config = TextEmbeddingPipeline.Config()
+    config.embedding_dimensions = embedding_dimensions
+    result = TextEmbeddingPipeline(models_path, "CPU", config).embed_documents(dataset_documents)
+    validate_embedding_results(refs, result)
+
+    config.embedding_type = TextEmbeddingPipeline.EmbeddingType.INT8
+    result = np.array(TextEmbeddingPipeline(models_path, "CPU", config).embed_documents(dataset_documents))
+    int8_refs = np.round(refs * 127 / np.abs(refs).max(axis=1, keepdims=True))
+    assert result.shape == refs.shape
+    # values close to .5 may be rounded differently
+    assert np.abs(result - int8_refs).max() <= 1
+
+    config.embedding_type = TextEmbeddingPipeline.EmbeddingType.UBINARY
+    result = np.array(TextEmbeddingPipeline(models_path, "CPU", config).embed_documents(dataset_documents), dtype=np.uint8)
+    ubinary_refs = np.packbits(refs > 0, axis=1)
+    assert result.shape == ubinary_refs.shape
+    # values close to 0 may have different signs
+    mismatched_bits = np.unpackbits(result ^ ubinary_refs).sum()
+    assert mismatched_bits <= 0.01 * refs.size
+
+
+@pytest.mark.parametrize("emb_model", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextEmbeddingPipeline.Config(batch_size=0),
         TextEmbeddingPipeline.Config(max_length=0),
         # more than model's max_position_embeddings (4096)
         TextEmbeddingPipeline.Config(max_length=4097),
@@ -772,10 +822,14 @@ def test_rerank_constructors(rerank_model):
     [
         TextRerankPipeline.Config(),
         TextRerankPipeline.Config(top_n=10),
+        TextRerankPipeline.Config(top_n=10, max_batch_tokens=64),
+        TextRerankPipeline.Config(top_n=10, max_batch_tokens=0),
     ],
     ids=[
         "top_n=default",
         "top_n=10",
+        "top_n=10, max_batch_tokens=64",
+        "top_n=10, max_batch_tokens=0",
     ],
 )
 def test_rerank_documents(rerank_model, dataset_documents, query, config):
@@ -853,10 +907,13 @@ def test_qwen3_seq_cls_rerank_documents(rerank_model: OVConvertedModelSchema, qu
             ),
         ),
         TextRerankPipeline.Config(top_n=4, padding_side="left"),
+        # a document per batch after the shared query prefix
+        TextRerankPipeline.Config(top_n=4, padding_side="left", max_batch_tokens=1),
     ],
     ids=[
         "top_n=4",
         "top_n=4, padding_side=left",
+        "top_n=4, padding_side=left, max_batch_tokens=1",
     ],
 )
 @pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 174635")
@@ -88,6 +88,37 @@ def test_encode(ov_hf_tokenizers, prompt):
         assert np.all(encoded_hf == encoded_ov[0])
 
 
+@pytest.mark.parametrize(
+    "model_id, is_cache_enabled",
+    [
+        # byte-level BPE, special tokens don't strip or normalize the text around them
+        ("Qwen/Qwen2-0.5B-Instruct", True),
+        # SentencePiece dummy prefix depends on where the text is split
+        ("optimum-intel-internal-testing/tiny-random-Phi3ForCausalLM", False),
+    ],
+)
+def test_tokenization_cache(model_id, is_cache_enabled):
+    model_schema = download_and_convert_model(model_id)
+    hf_tokenizer = model_schema.hf_tokenizer
+    ov_tokenizer = Tokenizer(model_schema.models_path, tokenization_cache_size=1 << 16)
+
+    # every prompt repeats the previous one split by a special token like a chat history
+    turns = ["You are a helpful assistant.", " What is OpenVINO?", "OpenVINO is a toolkit.\n", "你好！ 你好嗎？"]
+    for num_turns in range(1, len(turns) + 1):
+        prompt = hf_tokenizer.eos_token.join(turns[:num_turns])
+        for add_special_tokens in [True, False]:
+            encoded_ov = ov_tokenizer.encode(prompt, add_special_tokens=add_special_tokens).input_ids.data
+            encoded_hf = hf_tokenizer.encode(prompt, add_special_tokens=add_special_tokens)
+            assert np.all(encoded_hf == encoded_ov[0])
+
+    stats = ov_tokenizer.get_tokenization_cache_stats()
+    if is_cache_enabled:
+        assert stats.hits > 0
+        assert 0 < stats.get_hit_rate() < 1
+    else:
+        assert stats.hits == 0 and stats.misses == 0
+
+
 @pytest.mark.parametrize("ov_hf_tokenizers", get_models_list(), indirect=True)
 @pytest.mark.parametrize(
     "encoded_prompt", 
@@ -1,11 +1,17 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <fstream>
 #include <cstdlib>
 #include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <numeric>
 #include <ostream>
 #include <random>
+#include <sstream>
 #include <stdexcept>
 #include <thread>
 #include <mutex>
@@ -21,6 +27,18 @@
 
 namespace {
 
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+std::vector<std::string> split(const std::string& value, char delimiter) {
+    std::vector<std::string> parts;
+    std::stringstream stream(value);
+    for (std::string part; std::getline(stream, part, delimiter);) {
+        if (!part.empty())
+            parts.push_back(part);
+    }
+    return parts;
+}
+
 class AutoStartTimer {
     const decltype(std::chrono::steady_clock::now()) m_start;
 public:
@@ -81,7 +99,50 @@ struct Dataset {
     }
 };
 
-Dataset filtered_dataset(const std::string& models_path, const std::string& dataset_path, const size_t num_prompts, const size_t max_input_len, const size_t max_output_len) {
+// Mixture of prompt lengths: a request is taken from a bucket of prompts with input length in (previous bound, bound]
+// chosen with the bucket's probability
+struct PromptLenMix {
+    std::vector<size_t> m_bounds;
+    std::vector<double> m_weights;
+
+    // parses comma separated "<max_input_len>:<weight>" buckets, e.g. "128:0.6,512:0.3,2048:0.1"
+    static PromptLenMix parse(const std::string& mix) {
+        PromptLenMix prompt_len_mix;
+        std::vector<std::pair<size_t, double>> buckets;
+        for (const std::string& bucket : split(mix, ',')) {
+            const auto delimiter = bucket.find(':');
+            OPENVINO_ASSERT(delimiter != std::string::npos, "Prompt length bucket must be '<max_input_len>:<weight>', got ", bucket);
+            buckets.emplace_back(std::stoul(bucket.substr(0, delimiter)), std::stod(bucket.substr(delimiter + 1)));
+            OPENVINO_ASSERT(buckets.back().second > 0, "Weight of prompt length bucket must be positive, got ", bucket);
+        }
+        std::sort(buckets.begin(), buckets.end());
+        for (const auto& [bound, weight] : buckets) {
+            prompt_len_mix.m_bounds.push_back(bound);
+            prompt_len_mix.m_weights.push_back(weight);
+        }
+        return prompt_len_mix;
+    }
+
+    bool empty() const {
+        return m_bounds.empty();
+    }
+
+    size_t size() const {
+        return m_bounds.size();
+    }
+
+    // returns size() for prompts which are longer than all the buckets
+    size_t get_bucket(size_t input_len) const {
+        return std::lower_bound(m_bounds.begin(), m_bounds.end(), input_len) - m_bounds.begin();
+    }
+
+    double get_probability(size_t bucket) const {
+        return m_weights[bucket] / std::accumulate(m_weights.begin(), m_weights.end(), 0.0);
+    }
+};
+
+Dataset filtered_dataset(const std::string& models_path, const std::string& dataset_path, const size_t num_prompts, const size_t max_input_len, const size_t max_output_len,
+                         const PromptLenMix& prompt_len_mix) {
     std::ifstream json_file(dataset_path.c_str());
     OPENVINO_ASSERT(json_file.is_open(), "Cannot open dataset file");
 
@@ -96,7 +157,23 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
 
     ov::genai::Tokenizer tokenizer(models_path);
 
-    for (auto json_data_iterator = json_dataset.begin(); json_data_iterator != json_dataset.end() && dataset.size() < num_prompt_candidates; ++json_data_iterator) {
+    // indices of candidates per prompt length bucket and the number of candidates each bucket needs
+    std::vector<std::vector<size_t>> bucket_candidates(prompt_len_mix.size());
+    std::vector<size_t> bucket_num_candidates(prompt_len_mix.size());
+    for (size_t bucket = 0; bucket < prompt_len_mix.size(); ++bucket) {
+        bucket_num_candidates[bucket] = static_cast<size_t>(std::ceil(num_prompts * dataset_size_coeff * prompt_len_mix.get_probability(bucket)));
+    }
+    auto has_enough_candidates = [&] () {
+        if (prompt_len_mix.empty())
+            return dataset.size() >= num_prompt_candidates;
+        for (size_t bucket = 0; bucket < prompt_len_mix.size(); ++bucket) {
+            if (bucket_candidates[bucket].size() < bucket_num_candidates[bucket])
+                return false;
+        }
+        return true;
+    };
+
+    for (auto json_data_iterator = json_dataset.begin(); json_data_iterator != json_dataset.end() && !has_enough_candidates(); ++json_data_iterator) {
         auto & json_data = *json_data_iterator;
 
         // Filter out the conversations with less than 2 turns.
@@ -120,6 +197,14 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
         if (input_len > max_input_len || (input_len + output_len) > 2048)
             continue;
 
+        if (!prompt_len_mix.empty()) {
+            size_t bucket = prompt_len_mix.get_bucket(input_len);
+            // skip prompts out of the mix or of already filled buckets
+            if (bucket == prompt_len_mix.size() || bucket_candidates[bucket].size() >= bucket_num_candidates[bucket])
+                continue;
+            bucket_candidates[bucket].push_back(dataset.size());
+        }
+
         ov::genai::GenerationConfig greedy_search;
         greedy_search.max_new_tokens = std::min(max_output_len, output_len);
         greedy_search.ignore_eos = true;
@@ -128,9 +213,26 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
         dataset.push_lens(input_len, output_len);
     }
 
+    OPENVINO_ASSERT(!dataset.empty(), "No prompts in the dataset satisfy the length limits");
+
     // sample dataset
     srand(42);
 
+    if (!prompt_len_mix.empty()) {
+        for (size_t bucket = 0; bucket < prompt_len_mix.size(); ++bucket) {
+            OPENVINO_ASSERT(!bucket_candidates[bucket].empty(), "No prompts in the dataset for the prompt length bucket up to ", prompt_len_mix.m_bounds[bucket], " tokens");
+        }
+        std::mt19937 gen(42);
+        std::discrete_distribution<size_t> bucket_distribution(prompt_len_mix.m_weights.begin(), prompt_len_mix.m_weights.end());
+        while (sampled_dataset.size() < num_prompts) {
+            const auto& candidates = bucket_candidates[bucket_distribution(gen)];
+            size_t selected_index = candidates[rand() % candidates.size()];
+            sampled_dataset.push_data(dataset.m_prompts[selected_index], dataset.m_sampling_params[selected_index]);
+            sampled_dataset.push_lens(dataset.m_input_lens[selected_index], dataset.m_output_lens[selected_index]);
+        }
+        return sampled_dataset;
+    }
+
     for (size_t selected_index = rand() % dataset.size(); sampled_dataset.size() < num_prompts; selected_index = rand() % dataset.size()) {
         sampled_dataset.push_data(dataset.m_prompts[selected_index], dataset.m_sampling_params[selected_index]);
         sampled_dataset.push_lens(dataset.m_input_lens[selected_index], dataset.m_output_lens[selected_index]);
@@ -139,67 +241,108 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
     return sampled_dataset;
 }
 
+// Latency targets of a request, 0 means there is no target
+struct SLO {
+    double ttft_ms = 0;
+    double tpot_ms = 0;
+
+    bool empty() const {
+        return ttft_ms <= 0 && tpot_ms <= 0;
+    }
+};
+
+struct Percentiles {
+    double mean = 0, p50 = 0, p90 = 0, p99 = 0;
+
+    static Percentiles compute(std::vector<double> values) {
+        Percentiles percentiles;
+        if (values.empty())
+            return percentiles;
+        std::sort(values.begin(), values.end());
+        // linear interpolation between the closest ranks
+        auto percentile = [&values] (double p) {
+            double rank = p / 100.0 * (values.size() - 1);
+            size_t lower = static_cast<size_t>(rank);
+            size_t upper = std::min(lower + 1, values.size() - 1);
+            return values[lower] + (rank - lower) * (values[upper] - values[lower]);
+        };
+        percentiles.mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+        percentiles.p50 = percentile(50);
+        percentiles.p90 = percentile(90);
+        percentiles.p99 = percentile(99);
+        return percentiles;
+    }
+};
+
+struct LoadLevelReport {
+    std::string load_level;
+    double duration_s = 0;
+    size_t num_requests = 0;
+    // requests which met the SLO
+    size_t num_good_requests = 0;
+    Percentiles ttft_ms, tpot_ms, e2e_latency_ms;
+};
+
 class GenerationInfo {
 
     struct SequenceInfo {
-        std::chrono::milliseconds ttft;
-        std::chrono::milliseconds cumulated_tpot;
-        std::chrono::milliseconds mean_tpot;
-        size_t num_output_tokens;
-    
+        Milliseconds ttft = Milliseconds::zero();
+        Milliseconds mean_tpot = Milliseconds::zero();
+        size_t num_output_tokens = 0;
+
         std::chrono::steady_clock::time_point start_time;
+        std::chrono::steady_clock::time_point first_token_time;
         std::chrono::steady_clock::time_point last_read_time;
 
-        SequenceInfo(std::chrono::steady_clock::time_point& start_time) {
-            num_output_tokens = 0;
-            ttft = std::chrono::milliseconds::zero();
-            cumulated_tpot = std::chrono::milliseconds::zero();
-            this->start_time = start_time;
+        SequenceInfo(std::chrono::steady_clock::time_point start_time) : start_time(start_time) {
         }
 
-        void update() {
+        void update(size_t num_new_tokens) {
             std::chrono::steady_clock::time_point new_read_time = std::chrono::steady_clock::now();
-            if (last_read_time.time_since_epoch() == std::chrono::milliseconds::zero()) {
-                ttft = std::chrono::duration_cast<std::chrono::milliseconds>(new_read_time - start_time);
-            } else {
-                cumulated_tpot += std::chrono::duration_cast<std::chrono::milliseconds>(new_read_time - last_read_time);
-                mean_tpot = cumulated_tpot / num_output_tokens;
-
+            if (num_output_tokens == 0) {
+                ttft = new_read_time - start_time;
+                first_token_time = new_read_time;
             }
-            num_output_tokens++;
+            num_output_tokens += num_new_tokens;
             last_read_time = new_read_time;
+            // the first token is accounted by TTFT
+            if (num_output_tokens > 1)
+                mean_tpot = (last_read_time - first_token_time) / (num_output_tokens - 1);
         }
     };
 
     struct GenerationMetrics {
-        std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
-        std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
+        Milliseconds mean_ttft = Milliseconds::zero();
+        Milliseconds mean_tpot = Milliseconds::zero();
+        Milliseconds e2e_latency = Milliseconds::zero();
         size_t num_output_tokens = 0;
-        size_t num_input_tokens;
+        size_t num_input_tokens = 0;
     };
 
     ov::genai::GenerationHandle generation_handle;
+    // time when the request was scheduled to arrive, latencies are measured from it
     std::chrono::steady_clock::time_point start_time;
+    std::chrono::steady_clock::time_point end_time;
     std::unordered_map<int64_t, SequenceInfo> sequences_info;
     bool active = true;
     size_t input_len;
 
 public:
-    GenerationInfo(ov::genai::GenerationHandle generation_handle, size_t input_len) : input_len(input_len)
+    GenerationInfo(ov::genai::GenerationHandle generation_handle, size_t input_len, std::chrono::steady_clock::time_point start_time) :
+        generation_handle(std::move(generation_handle)), start_time(start_time), input_len(input_len)
     {
-        this->generation_handle = std::move(generation_handle);
-        start_time = std::chrono::steady_clock::now();
     }
 
-    void update_sequence(int64_t sequence_id) {
+    void update_sequence(int64_t sequence_id, size_t num_new_tokens) {
         if (sequences_info.find(sequence_id) == sequences_info.end())
             sequences_info.emplace(sequence_id, SequenceInfo(start_time));
-        sequences_info.at(sequence_id).update();
+        sequences_info.at(sequence_id).update(num_new_tokens);
     }
 
     void update(ov::genai::GenerationOutputs& outputs){
         for (auto const& output: outputs) {
-            update_sequence(output.first);
+            if (!output.second.generated_ids.empty())
+                update_sequence(output.first, output.second.generated_ids.size());
         }
     }
 
@@ -217,6 +360,7 @@ public:
 
     void set_inactive() {
         active = false;
+        end_time = std::chrono::steady_clock::now();
     }
 
     bool is_active() {
@@ -235,6 +379,7 @@ public:
             generation_metrics.mean_tpot /= sequences_info.size();
             generation_metrics.num_input_tokens = input_len;
         }
+        generation_metrics.e2e_latency = end_time - start_time;
         return generation_metrics;
     }
 };
@@ -251,7 +396,7 @@ public:
         this->start_time = start_time;
     }
 
-    void add_generation(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, size_t request_id, bool is_speculative_decoding_enabled) {
+    void add_generation(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, size_t request_id, std::chrono::steady_clock::time_point arrival_time, bool is_speculative_decoding_enabled) {
         auto sampling_params = dataset->m_sampling_params[request_id];
         if (is_speculative_decoding_enabled) {
             // to enable static speculative decoding
@@ -261,7 +406,7 @@ public:
         }
         ov::genai::GenerationHandle generation_handle = pipe->add_request(request_id, dataset->m_prompts[request_id], sampling_params);
         std::lock_guard<std::mutex> lock(mutex);
-        generations_info.emplace_back(std::move(generation_handle), dataset->m_input_lens[request_id]);
+        generations_info.emplace_back(std::move(generation_handle), dataset->m_input_lens[request_id], arrival_time);
     }
 
     size_t run() {
@@ -269,61 +414,173 @@ public:
         for (GenerationInfo& generation_info : generations_info) {
             if (!generation_info.is_active())
                 continue;
-            
-            if (generation_info.is_finished()) {
-                num_finished++;
-                generation_info.set_inactive();
-            } else if (generation_info.can_read()) {
+
+            if (generation_info.can_read()) {
                 auto outputs = generation_info.read();
                 generation_info.update(outputs);
+            } else if (generation_info.is_finished()) {
+                num_finished++;
+                generation_info.set_inactive();
             }
         }
         return num_finished;
     }
 
-    void print_statistics() {
-        std::chrono::seconds total_duration = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time);
-        std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
-        std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
+    LoadLevelReport print_statistics(const std::string& load_level, const SLO& slo) {
+        const double total_duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        std::vector<double> ttfts, tpots, e2e_latencies;
         size_t total_input_len = 0;
         size_t total_output_len = 0;
-        
-    
+        size_t num_good_requests = 0, good_output_len = 0;
+
         for (GenerationInfo& generation_info : generations_info){
             auto generation_metrics = generation_info.get_metrics();
-            mean_ttft += generation_metrics.mean_ttft;
-            mean_tpot += generation_metrics.mean_tpot;
+            ttfts.push_back(generation_metrics.mean_ttft.count());
+            tpots.push_back(generation_metrics.mean_tpot.count());
+            e2e_latencies.push_back(generation_metrics.e2e_latency.count());
             total_input_len += generation_metrics.num_input_tokens;
             total_output_len += generation_metrics.num_output_tokens;
+
+            if ((slo.ttft_ms <= 0 || generation_metrics.mean_ttft.count() <= slo.ttft_ms) &&
+                (slo.tpot_ms <= 0 || generation_metrics.mean_tpot.count() <= slo.tpot_ms)) {
+                num_good_requests++;
+                good_output_len += generation_metrics.num_output_tokens;
+            }
         }
-        mean_ttft /= generations_info.size();
-        mean_tpot /= generations_info.size();
-        std::cout << "Benchmark duration: " << total_duration.count() << " s" << std::endl;
+
+        LoadLevelReport report;
+        report.load_level = load_level;
+        report.duration_s = total_duration;
+        report.num_requests = generations_info.size();
+        report.num_good_requests = num_good_requests;
+        report.ttft_ms = Percentiles::compute(ttfts);
+        report.tpot_ms = Percentiles::compute(tpots);
+        report.e2e_latency_ms = Percentiles::compute(e2e_latencies);
+
+        auto print_percentiles = [] (const std::string& name, const Percentiles& percentiles) {
+            std::cout << name << ": mean " << percentiles.mean << " ms, p50 " << percentiles.p50 << " ms, p90 " << percentiles.p90
+                      << " ms, p99 " << percentiles.p99 << " ms" << std::endl;
+        };
+        std::cout << "Load level: " << load_level << std::endl;
+        std::cout << "Benchmark duration: " << total_duration << " s" << std::endl;
         std::cout << "Total number of input tokens: " << total_input_len << std::endl;
         std::cout << "Total number of output tokens: " << total_output_len << std::endl;
-        std::cout << "Input throughput: " << total_input_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Output throughput: " << total_output_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Mean TTFT: " << mean_ttft.count() << " ms" << std::endl;
-        std::cout << "Mean TPOT: " << mean_tpot.count() << " ms" << std::endl; 
+        std::cout << "Request throughput: " << report.num_requests / total_duration << " requests / s" << std::endl;
+        std::cout << "Input throughput: " << total_input_len / total_duration << " tokens / s" << std::endl;
+        std::cout << "Output throughput: " << total_output_len / total_duration << " tokens / s" << std::endl;
+        print_percentiles("TTFT", report.ttft_ms);
+        print_percentiles("TPOT", report.tpot_ms);
+        print_percentiles("E2E latency", report.e2e_latency_ms);
+        if (!slo.empty()) {
+            std::cout << "Requests meeting SLO: " << num_good_requests << " / " << report.num_requests << std::endl;
+            std::cout << "Goodput: " << num_good_requests / total_duration << " requests / s, "
+                      << good_output_len / total_duration << " tokens / s" << std::endl;
+        }
+        return report;
     }
 };
 
-void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
-    double numeric_request_rate;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::exponential_distribution<> distribution;
+// Scheduler state after every step of the pipeline
+class StepStatsCollector {
+    struct StepStats {
+        size_t load_level;
+        double time_ms;
+        ov::genai::PipelineMetrics metrics;
+    };
+
+    std::vector<StepStats> m_steps;
+    std::atomic<size_t> m_load_level{0};
+    const std::chrono::steady_clock::time_point m_start_time = std::chrono::steady_clock::now();
 
-    if (request_rate == "inf") {
-        numeric_request_rate = -1.0;
-    } else {
-        numeric_request_rate = std::stod(request_rate);
-        if (numeric_request_rate < 0)
-            throw std::invalid_argument("request_rate cannot be a negative number");
+public:
+    void set_load_level(size_t load_level) {
+        m_load_level = load_level;
+    }
+
+    // called by LLM engine thread only
+    void add(const ov::genai::PipelineMetrics& metrics) {
+        m_steps.push_back({m_load_level, Milliseconds(std::chrono::steady_clock::now() - m_start_time).count(), metrics});
+    }
+
+    // JSON if the file has .json extension, CSV otherwise
+    void dump(const std::string& path, const std::vector<std::string>& load_levels) const {
+        std::ofstream file(path);
+        OPENVINO_ASSERT(file.is_open(), "Cannot open step statistics file ", path);
+        const bool is_json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+        if (is_json) {
+            nlohmann::json json_steps = nlohmann::json::array();
+            for (size_t step = 0; step < m_steps.size(); ++step) {
+                const auto& step_stats = m_steps[step];
+                json_steps.push_back({
+                    {"load_level", load_levels[step_stats.load_level]},
+                    {"step", step},
+                    {"time_ms", step_stats.time_ms},
+                    {"requests", step_stats.metrics.requests},
+                    {"scheduled_requests", step_stats.metrics.scheduled_requests},
+                    {"scheduled_tokens", step_stats.metrics.scheduled_tokens},
+                    {"preempted_requests", step_stats.metrics.preempted_requests},
+                    {"cache_usage", step_stats.metrics.cache_usage},
+                    {"inference_duration_ms", step_stats.metrics.inference_duration / 1000},
+                });
+            }
+            file << json_steps.dump(2) << std::endl;
+            return;
+        }
+        file << "load_level,step,time_ms,requests,scheduled_requests,scheduled_tokens,preempted_requests,cache_usage,inference_duration_ms" << std::endl;
+        for (size_t step = 0; step < m_steps.size(); ++step) {
+            const auto& step_stats = m_steps[step];
+            file << load_levels[step_stats.load_level] << ',' << step << ',' << step_stats.time_ms << ','
+                 << step_stats.metrics.requests << ',' << step_stats.metrics.scheduled_requests << ','
+                 << step_stats.metrics.scheduled_tokens << ',' << step_stats.metrics.preempted_requests << ','
+                 << step_stats.metrics.cache_usage << ',' << step_stats.metrics.inference_duration / 1000 << std::endl;
+        }
+    }
+};
 
-        distribution = std::exponential_distribution<>(numeric_request_rate);
+// Offsets of requests arrival from the start of a load level in seconds. All the requests arrive at once for "inf" request rate.
+// Otherwise, inter-arrival times are exponential ("poisson") or follow gamma distribution ("gamma") with shape `burstiness`:
+// 1 is Poisson process, lower values make arrivals burstier. "trace" replays arrival times in seconds from `trace_path`, one per line.
+std::vector<double> get_arrival_times(const std::string& arrival_process, const std::string& request_rate, double burstiness, const std::string& trace_path, size_t num_requests) {
+    std::vector<double> arrival_times;
+    if (arrival_process == "trace") {
+        std::ifstream trace_file(trace_path);
+        OPENVINO_ASSERT(trace_file.is_open(), "Cannot open arrival trace file ", trace_path);
+        for (double arrival_time; trace_file >> arrival_time;) {
+            arrival_times.push_back(arrival_time);
+        }
+        OPENVINO_ASSERT(!arrival_times.empty(), "Arrival trace file ", trace_path, " is empty");
+        std::sort(arrival_times.begin(), arrival_times.end());
+        const double first_arrival_time = arrival_times.front();
+        for (double& arrival_time : arrival_times)
+            arrival_time -= first_arrival_time;
+        arrival_times.resize(std::min(arrival_times.size(), num_requests));
+        return arrival_times;
     }
 
+    arrival_times.resize(num_requests, 0.0);
+    if (request_rate == "inf")
+        return arrival_times;
+
+    double numeric_request_rate = std::stod(request_rate);
+    if (numeric_request_rate <= 0)
+        throw std::invalid_argument("request_rate must be a positive number");
+
+    OPENVINO_ASSERT(arrival_process == "poisson" || arrival_process == "gamma", "Unknown arrival process: ", arrival_process, ". Supported: poisson, gamma, trace");
+    OPENVINO_ASSERT(burstiness > 0, "burstiness must be positive");
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::exponential_distribution<> exponential_distribution(numeric_request_rate);
+    // mean inter-arrival time is kept 1 / request_rate
+    std::gamma_distribution<> gamma_distribution(burstiness, 1.0 / (numeric_request_rate * burstiness));
+    for (size_t request_id = 1; request_id < num_requests; ++request_id) {
+        double inter_arrival_time = arrival_process == "gamma" ? gamma_distribution(gen) : exponential_distribution(gen);
+        arrival_times[request_id] = arrival_times[request_id - 1] + inter_arrival_time;
+    }
+    return arrival_times;
+}
+
+void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string load_level, const std::vector<double>* arrival_times, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
     /*
     std::cout << "Total input tokens: " << dataset->m_total_input_len << std::endl;
     std::cout << "Total output tokens: " << dataset->m_total_output_len << std::endl;
@@ -331,40 +588,61 @@ void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* data
     std::cout << "Average output len: " << dataset->get_average_output_len() << " tokens" << std::endl;
     */
 
-    std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
-    generation_info_collector->set_start_time(std::chrono::steady_clock::now());
-    for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+    std::cout << "Launching traffic simulator thread with load level: " << load_level << std::endl;
+    const auto start_time = std::chrono::steady_clock::now();
+    generation_info_collector->set_start_time(start_time);
+    for (size_t request_id = 0; request_id < arrival_times->size(); ++request_id) {
+        // open loop: requests arrive by the schedule regardless of how fast the previous ones are served
+        const auto arrival_time = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>((*arrival_times)[request_id]));
+        std::this_thread::sleep_until(arrival_time);
         std::cout << "Traffic thread adding request to the queue..." << std::endl;
-        generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
-        if (numeric_request_rate > 0)
-            std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
+        generation_info_collector->add_generation(pipe, dataset, request_id, arrival_time, is_speculative_decoding_enabled);
     }
     std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
 }
 
-void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::atomic<bool>* finishThread) {
+void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, StepStatsCollector* step_stats_collector, std::atomic<bool>* finishThread) {
     std::cout << "Launching LLM engine thread" << std::endl;
-    size_t num_finished = 0;
 
     while (!(*finishThread)) {
         while (pipe->has_non_finished_requests()) {
             pipe->step();
+            if (step_stats_collector)
+                step_stats_collector->add(pipe->get_metrics());
         }
     }
     std::cout << "All requests processed, LLM Engine loop escaped. Exiting thread." << std::endl;
 }
 
-void statisticsReporter(GenerationInfoCollector* generations_info_collector, int num_prompts) {
-    int num_finished = 0;
-    while (num_finished < num_prompts) {
+void statisticsReporter(GenerationInfoCollector* generations_info_collector, size_t num_requests, std::string load_level, SLO slo, LoadLevelReport* report) {
+    size_t num_finished = 0;
+    while (num_finished < num_requests) {
         num_finished = generations_info_collector->run();
     }
     std::cout << "Benchmark finished, summarizing statistics..." << std::endl;
-    generations_info_collector->print_statistics();
+    *report = generations_info_collector->print_statistics(load_level, slo);
 
     std::cout << "Exiting statistics reporter thread." << std::endl;
 }
 
+void print_summary(const std::vector<LoadLevelReport>& reports, const SLO& slo) {
+    auto format = [] (const Percentiles& percentiles) {
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(1) << percentiles.p50 << " / " << percentiles.p90 << " / " << percentiles.p99;
+        return stream.str();
+    };
+    std::cout << "Summary (latencies in ms, p50 / p90 / p99):" << std::endl;
+    std::cout << std::left << std::setw(12) << "Load level" << std::setw(14) << "Requests / s" << std::setw(28) << "TTFT"
+              << std::setw(28) << "TPOT" << std::setw(28) << "E2E latency" << (slo.empty() ? "" : "Goodput, requests / s") << std::endl;
+    for (const LoadLevelReport& report : reports) {
+        std::cout << std::left << std::setw(12) << report.load_level << std::setw(14) << report.num_requests / report.duration_s
+                  << std::setw(28) << format(report.ttft_ms) << std::setw(28) << format(report.tpot_ms) << std::setw(28) << format(report.e2e_latency_ms);
+        if (!slo.empty())
+            std::cout << report.num_good_requests / report.duration_s;
+        std::cout << std::endl;
+    }
+}
+
 bool parse_plugin_config_json(nlohmann::json& node, ov::AnyMap& device_config_map) {
     if (!node.is_object()) {
         std::cout << "Error: nlohmann json object is not an object." << std::endl;
@@ -440,7 +718,14 @@ int main(int argc, char* argv[]) try {
     ("dataset", "Path to dataset .json file", cxxopts::value<std::string>()->default_value("./ShareGPT_V3_unfiltered_cleaned_split.json"))
     ("max_input_len", "Max input length take from dataset", cxxopts::value<size_t>()->default_value("1024"))
     ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("2048"))
-    ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, we use Poisson process to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
+    ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, arrival_process synthesizes the request arrival times. Comma separated list runs a benchmark per load level, e.g. 1,2,4", cxxopts::value<std::string>()->default_value("inf"))
+    ("arrival_process", "Arrival times of requests: poisson, gamma or trace. Default: poisson", cxxopts::value<std::string>()->default_value("poisson"))
+    ("burstiness", "Shape of gamma distribution of inter-arrival times: 1 is Poisson process, lower values make arrivals burstier. Default: 1", cxxopts::value<double>()->default_value("1"))
+    ("trace", "Path to arrival trace for trace arrival process: arrival time in seconds per line. request_rate is ignored", cxxopts::value<std::string>()->default_value(""))
+    ("prompt_len_mix", "Mixture of prompt lengths as comma separated <max_input_len>:<weight> buckets, e.g. 128:0.6,512:0.3,1024:0.1. Default: dataset distribution", cxxopts::value<std::string>()->default_value(""))
+    ("slo_ttft", "TTFT target of a request in ms to compute goodput. Default: 0 (no target)", cxxopts::value<double>()->default_value("0"))
+    ("slo_tpot", "TPOT target of a request in ms to compute goodput. Default: 0 (no target)", cxxopts::value<double>()->default_value("0"))
+    ("step_stats", "Path to .json or .csv file to dump scheduler statistics of every pipeline step", cxxopts::value<std::string>()->default_value(""))
     ("cache_size", "Size of memory used for KV cache in GB. Default: 16", cxxopts::value<size_t>()->default_value("16"))
     ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
     ("device_config", "Plugin configuration JSON. Example: '{\"MODEL_DISTRIBUTION_POLICY\":\"TENSOR_PARALLEL\",\"PERF_COUNT\":true}' Default: {\"PERF_COUNT\":true}", cxxopts::value<std::string>()->default_value("{\"PERF_COUNT\":true}"))
@@ -474,11 +759,22 @@ int main(int argc, char* argv[]) try {
     const std::string device_config = result["device_config"].as<std::string>();
     const size_t cache_size = result["cache_size"].as<size_t>();
     const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
+    const std::string arrival_process = result["arrival_process"].as<std::string>();
+    const double burstiness = result["burstiness"].as<double>();
+    const std::string trace_path = result["trace"].as<std::string>();
+    const PromptLenMix prompt_len_mix = PromptLenMix::parse(result["prompt_len_mix"].as<std::string>());
+    SLO slo;
+    slo.ttft_ms = result["slo_ttft"].as<double>();
+    slo.tpot_ms = result["slo_tpot"].as<double>();
+    const std::string step_stats_path = result["step_stats"].as<std::string>();
 
     bool is_speculative_decoding_enabled = !draft_model_path.empty();
 
+    const std::vector<std::string> load_levels = arrival_process == "trace" ? std::vector<std::string>{"trace"} : split(request_rate, ',');
+    OPENVINO_ASSERT(!load_levels.empty(), "request_rate is empty");
+
     // Create requests for generation
-    Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len);
+    Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len, prompt_len_mix);
 
     // Perform the first inference
     ov::genai::SchedulerConfig scheduler_config;
@@ -501,6 +797,11 @@ int main(int argc, char* argv[]) try {
     std::cout << "\tNum prompts: " << num_prompts << std::endl;
     std::cout << "\tMax input length: " << max_input_len << std::endl;
     std::cout << "\tMax output length: " << max_output_len << std::endl;
+    if (!prompt_len_mix.empty()) {
+        std::cout << "\tPrompt length mix: " << result["prompt_len_mix"].as<std::string>() << std::endl;
+    }
+    std::cout << "\tArrival process: " << arrival_process << std::endl;
+    std::cout << "\tLoad levels: " << (arrival_process == "trace" ? trace_path : request_rate) << std::endl;
     std::cout << "\tTarget device: " << device << std::endl;
     std::cout << "\tPlugin configuration JSON: " << device_config << std::endl;
 
@@ -519,24 +820,30 @@ int main(int argc, char* argv[]) try {
 
     std::cout << "Setup finished, launching LLM executor, traffic simulation and statistics reporter threads" << std::endl;
 
-    GenerationInfoCollector generation_info_collector;
+    StepStatsCollector step_stats_collector;
+    std::vector<LoadLevelReport> reports(load_levels.size());
 
     std::atomic<bool> finishGenerationThread{false};
-    if (request_rate == "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
+    std::thread lmmEngineThread(llmEngineLoop, &pipe, step_stats_path.empty() ? nullptr : &step_stats_collector, &finishGenerationThread);
+    for (size_t load_level = 0; load_level < load_levels.size(); ++load_level) {
+        const std::vector<double> arrival_times = get_arrival_times(arrival_process, load_levels[load_level], burstiness, trace_path, dataset.size());
+        step_stats_collector.set_load_level(load_level);
+        GenerationInfoCollector generation_info_collector;
+
+        std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, arrival_times.size(), load_levels[load_level], slo, &reports[load_level]);
+        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, load_levels[load_level], &arrival_times, &generation_info_collector, is_speculative_decoding_enabled);
         trafficSimulatorThread.join();
+        statisticsReporterThread.join();
     }
-    
-    std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
-    std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
-    if (request_rate != "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
-        trafficSimulatorThread.join();
-    }
-    statisticsReporterThread.join();
     finishGenerationThread = true;
     lmmEngineThread.join();
 
+    print_summary(reports, slo);
+    if (!step_stats_path.empty()) {
+        step_stats_collector.dump(step_stats_path, load_levels);
+        std::cout << "Scheduler statistics of every step are saved to " << step_stats_path << std::endl;
+    }
+
     std::cout << "Benchmark finished" << std::endl;
 } catch (const std::exception& error) {
     try {